@@ -2,9 +2,9 @@
 #include <stdlib.h>
 #include <string.h>
 #include <ctype.h>
-#include <math.h>
 #include "tokenizer.h"
 #include "hash_table.h"
+#include "../Common/hex.h"
 
 #ifdef _MSC_VER
 #define _CRT_SECURE_NO_WARNINGS
@@ -152,24 +152,7 @@ char *register_address(char *registerName) {
 
 
 int convert_to_decimal(char *hex_value) {
-    char hex[10];
-    long long decimal = 0, base = 1;
-    int i, length = 10;
-    /* Get hexadecimal value from user */
-    memcpy(hex, hex_value, 10 * sizeof(char));
-    for (i = length--; i >= 0; i--) {
-        if (hex[i] >= '0' && hex[i] <= '9') {
-            decimal += (hex[i] - 48) * base;
-            base *= 16;
-        } else if (hex[i] >= 'A' && hex[i] <= 'F') {
-            decimal += (hex[i] - 55) * base;
-            base *= 16;
-        } else if (hex[i] >= 'a' && hex[i] <= 'f') {
-            decimal += (hex[i] - 87) * base;
-            base *= 16;
-        }
-    }
-    return (int)(decimal);
+    return (int) hex_parse(hex_value + 2, 8);     // skip the 0x prefix.
 }
 
 
@@ -269,24 +252,7 @@ int islabel(char *label) {
 		in size - number of digits in hex representation - Padded with zeros
 */
 void dec_to_hex(char *hex, int dec, int size) {
-    int temp;
-    long long q = dec;
-    int j;
-    if (q < 0) {              // Signed representation for negative numbers.
-        q = pow(2, ((double) size * 4)) +q;              // 2^bits + negative number ran through an unsigned conversion equals the signed conversion.
-    }
-    for (j = 0; j < size; j++) {
-        temp = q % 16;
-        if (temp < 10)
-            temp = temp + 48;
-        else
-            temp = temp + 55;
-        hex[size - 1 - j] = temp;
-        q = q / 16;
-    }
-    for (int i = 0; hex[i]; i++) {
-        hex[i] = tolower(hex[i]);
-    }
+    hex_format(hex, (uint32_t) dec, size, 0);     // negative numbers come out in two's complement.
 }
 
 
@@ -575,9 +541,61 @@ void parser(FILE *fptr, int pass, hash_table_t *hash_table, FILE *Out, char *Mem
     }
 }
 
+// Symbol Sort Comparison Function, by address then by name
+int symbol_comp(const void *a, const void *b) {
+    const hash_entry_t *first = *(const hash_entry_t **) a;
+    const hash_entry_t *second = *(const hash_entry_t **) b;
+    uint32_t first_address = *(uint32_t *) first->data;
+    uint32_t second_address = *(uint32_t *) second->data;
+
+    if (first_address != second_address)
+        return first_address < second_address ? -1 : 1;
+    return strcmp((char *) first->key, (char *) second->key);
+}
+
+/*
+  description:
+	writes the labels found in pass 1 as a symbol map, a line per label sorted by address:
+	the address in 3 hex digits as the trace prints PC, then the label. the simulator's profiler reads it.
+
+*/
+void write_symbols(hash_table_t *hash_table, char *Symbols) {
+    int count = 0, capacity = 64;
+    hash_entry_t **entries = calloc_and_check(capacity, sizeof(hash_entry_t *));
+
+    for (uint32_t row = 0; row < hash_table->size; row++) {
+        for (hash_entry_t *entry = hash_table->row[row]; entry != NULL; entry = entry->next) {
+            if (count == capacity) {
+                capacity *= 2;
+                entries = realloc(entries, capacity * sizeof(hash_entry_t *));
+                if (entries == NULL) {
+                    printf("Out of memory\n");
+                    exit(1);
+                }
+            }
+            entries[count++] = entry;
+        }
+    }
+
+    qsort(entries, count, sizeof(hash_entry_t *), symbol_comp);
+
+    FILE *fptr = fopen(Symbols, "w");
+    if (fptr == NULL) {
+        printf("Symbol file could not opened.");
+        exit(1);
+    }
+
+    for (int i = 0; i < count; i++) {
+        fprintf(fptr, "%03X %s\n", *(uint32_t *) entries[i]->data & 0xFFF, (char *) entries[i]->key);
+    }
+
+    fclose(fptr);
+    free(entries);
+}
+
 int main(int argc, char *argv[]) {
-    // Make sure correct number of arguments input
-    if (argc != 4) {
+    // Make sure correct number of arguments input, the symbol map is optional
+    if (argc != 4 && argc != 5) {
         printf("Incorrect number of arguments");
     } else {
         // Open I/O files
@@ -614,6 +632,10 @@ int main(int argc, char *argv[]) {
         int passNumber = 1;
         parser(In, passNumber, hash_table, Out, argv[3]);
 
+        // Labels are all known after pass 1
+        if (argc == 5)
+            write_symbols(hash_table, argv[4]);
+
         // Rewind input file & start pass 2
         rewind(In);
         passNumber = 2;
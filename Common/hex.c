@@ -0,0 +1,366 @@
+#include <string.h>
+
+#include "hex.h"
+
+#if !defined(SIMP_NO_SIMD) && (defined(__x86_64__) || defined(_M_X64) || (defined(__i386__) && defined(__SSE2__)) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define HEX_SIMD 1
+#include <emmintrin.h>
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#define AVX2_TARGET
+#else
+#define AVX2_TARGET __attribute__((target("avx2")))
+#endif
+#endif
+
+#define WORD_DIGITS 8
+#define LINE_STRIDE (WORD_DIGITS + 1)		// 8 digits and '\n'.
+
+static const char lowercase_digits[] = "0123456789abcdef";
+static const char uppercase_digits[] = "0123456789ABCDEF";
+
+/*
+  description:
+	hex digit values plus one, zero for characters that aren't hex digits.
+
+*/
+static const uint8_t hex_digit[256] = {
+	['0'] = 1, ['1'] = 2, ['2'] = 3, ['3'] = 4, ['4'] = 5, ['5'] = 6, ['6'] = 7, ['7'] = 8, ['8'] = 9, ['9'] = 10,
+	['a'] = 11, ['b'] = 12, ['c'] = 13, ['d'] = 14, ['e'] = 15, ['f'] = 16,
+	['A'] = 11, ['B'] = 12, ['C'] = 13, ['D'] = 14, ['E'] = 15, ['F'] = 16
+};
+
+/*
+  description:
+	value of the hex digits at the start of text, up to 'digits' of them. stops at the first character that isn't one.
+
+*/
+uint32_t hex_parse(const char* text, int digits) {
+
+	uint32_t value = 0;
+	int i;
+
+	for (i = 0; i < digits; i++) {
+
+		uint32_t digit = hex_digit[(uint8_t)text[i]];
+
+		if (digit == 0) {
+			break;
+		}
+
+		value = (value << 4) | (digit - 1);
+	}
+
+	return value;
+}
+
+/*
+  description:
+	the low digits * 4 bits of value as 'digits' hex digits, zero padded and not terminated.
+	negative numbers come out in two's complement.
+
+*/
+void hex_format(char* hex, uint32_t value, int digits, int uppercase) {
+
+	const char* symbols = uppercase ? uppercase_digits : lowercase_digits;
+	int i;
+
+	for (i = digits - 1; i >= 0; i--) {
+
+		hex[i] = symbols[value & 0xF];
+		value >>= 4;
+	}
+}
+
+static void encode_words_scalar(char* text, const uint32_t* words, size_t count, size_t stride, int uppercase) {
+
+	size_t i;
+
+	for (i = 0; i < count; i++) {
+		hex_format(text + i * stride, words[i], WORD_DIGITS, uppercase);
+	}
+}
+
+static size_t decode_lines_scalar(uint32_t* words, const char* text, size_t count) {
+
+	size_t i;
+	int j;
+
+	for (i = 0; i < count; i++) {
+
+		const char* line = text + i * LINE_STRIDE;
+		uint32_t value = 0;
+
+		for (j = 0; j < WORD_DIGITS; j++) {
+
+			uint32_t digit = hex_digit[(uint8_t)line[j]];
+
+			if (digit == 0) {
+				return i;
+			}
+
+			value = (value << 4) | (digit - 1);
+		}
+
+		if (line[WORD_DIGITS] != '\n') {
+			return i;
+		}
+
+		words[i] = value;
+	}
+
+	return count;
+}
+
+#ifdef HEX_SIMD
+
+/*
+  description:
+	SSE2 kernels, two or four words at a time. digits are produced most significant first, so words are byte swapped
+	around the nibble split.
+
+*/
+static __m128i bswap32_sse2(__m128i x) {
+
+	x = _mm_or_si128(_mm_slli_epi16(x, 8), _mm_srli_epi16(x, 8));
+	x = _mm_shufflelo_epi16(x, _MM_SHUFFLE(2, 3, 0, 1));
+	return _mm_shufflehi_epi16(x, _MM_SHUFFLE(2, 3, 0, 1));
+}
+
+static __m128i nibbles_to_digits_sse2(__m128i nibbles, int uppercase) {
+
+	__m128i letters = _mm_and_si128(_mm_cmpgt_epi8(nibbles, _mm_set1_epi8(9)), _mm_set1_epi8(uppercase ? 'A' - '0' - 10 : 'a' - '0' - 10));
+
+	return _mm_add_epi8(_mm_add_epi8(nibbles, _mm_set1_epi8('0')), letters);
+}
+
+static void encode_words_sse2(char* text, const uint32_t* words, size_t count, size_t stride, int uppercase) {
+
+	const __m128i mask = _mm_set1_epi8(0x0F);
+	size_t i;
+
+	for (i = 0; i + 4 <= count; i += 4) {
+
+		__m128i x = bswap32_sse2(_mm_loadu_si128((const __m128i*)(words + i)));
+		__m128i high = _mm_and_si128(_mm_srli_epi16(x, 4), mask);
+		__m128i low = _mm_and_si128(x, mask);
+		__m128i first = nibbles_to_digits_sse2(_mm_unpacklo_epi8(high, low), uppercase);		// words i, i + 1
+		__m128i second = nibbles_to_digits_sse2(_mm_unpackhi_epi8(high, low), uppercase);		// words i + 2, i + 3
+
+		if (stride == WORD_DIGITS) {
+
+			_mm_storeu_si128((__m128i*)(text + i * WORD_DIGITS), first);
+			_mm_storeu_si128((__m128i*)(text + i * WORD_DIGITS + 16), second);
+		}
+		else {
+
+			_mm_storel_epi64((__m128i*)(text + i * stride), first);
+			_mm_storel_epi64((__m128i*)(text + (i + 1) * stride), _mm_srli_si128(first, 8));
+			_mm_storel_epi64((__m128i*)(text + (i + 2) * stride), second);
+			_mm_storel_epi64((__m128i*)(text + (i + 3) * stride), _mm_srli_si128(second, 8));
+		}
+	}
+
+	encode_words_scalar(text + i * stride, words + i, count - i, stride, uppercase);
+}
+
+/*
+  description:
+	two lines of digits, loaded side by side into c, to two words in the low half of the result.
+	returns 0 when a character isn't a hex digit.
+
+*/
+static int decode_two_sse2(__m128i c, __m128i* words) {
+
+	__m128i lower = _mm_or_si128(c, _mm_set1_epi8(0x20));
+	__m128i digit = _mm_and_si128(_mm_cmpgt_epi8(c, _mm_set1_epi8('0' - 1)), _mm_cmplt_epi8(c, _mm_set1_epi8('9' + 1)));
+	__m128i letter = _mm_and_si128(_mm_cmpgt_epi8(lower, _mm_set1_epi8('a' - 1)), _mm_cmplt_epi8(lower, _mm_set1_epi8('f' + 1)));
+	__m128i nibbles, bytes;
+
+	if (_mm_movemask_epi8(_mm_or_si128(digit, letter)) != 0xFFFF) {
+		return 0;
+	}
+
+	nibbles = _mm_or_si128(_mm_and_si128(digit, _mm_sub_epi8(c, _mm_set1_epi8('0'))), _mm_andnot_si128(digit, _mm_sub_epi8(lower, _mm_set1_epi8('a' - 10))));
+	bytes = _mm_and_si128(_mm_or_si128(_mm_slli_epi16(nibbles, 4), _mm_srli_epi16(nibbles, 8)), _mm_set1_epi16(0x00FF));
+
+	*words = bswap32_sse2(_mm_packus_epi16(bytes, bytes));
+	return 1;
+}
+
+static size_t decode_lines_sse2(uint32_t* words, const char* text, size_t count) {
+
+	size_t i;
+
+	for (i = 0; i + 2 <= count; i += 2) {
+
+		const char* line = text + i * LINE_STRIDE;
+		__m128i value;
+
+		if (line[WORD_DIGITS] != '\n' || line[LINE_STRIDE + WORD_DIGITS] != '\n') {
+			break;
+		}
+
+		if (!decode_two_sse2(_mm_unpacklo_epi64(_mm_loadl_epi64((const __m128i*)line), _mm_loadl_epi64((const __m128i*)(line + LINE_STRIDE))), &value)) {
+			break;
+		}
+
+		_mm_storel_epi64((__m128i*)(words + i), value);
+	}
+
+	return i + decode_lines_scalar(words + i, text + i * LINE_STRIDE, count - i);
+}
+
+/*
+  description:
+	AVX2 kernels, eight words per step to encode and four lines per step to decode. the 256 bit unpack and pack
+	instructions work per 128 bit lane, hence the lane permutes.
+
+*/
+AVX2_TARGET static void encode_words_avx2(char* text, const uint32_t* words, size_t count, size_t stride, int uppercase) {
+
+	const __m256i bswap = _mm256_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12, 3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+	const __m256i symbols = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)(uppercase ? uppercase_digits : lowercase_digits)));
+	const __m256i mask = _mm256_set1_epi8(0x0F);
+	size_t i;
+
+	for (i = 0; i + 8 <= count; i += 8) {
+
+		__m256i x = _mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i*)(words + i)), bswap);
+		__m256i high = _mm256_and_si256(_mm256_srli_epi16(x, 4), mask);
+		__m256i low = _mm256_and_si256(x, mask);
+		__m256i first = _mm256_shuffle_epi8(symbols, _mm256_unpacklo_epi8(high, low));		// words 0, 1 | 4, 5
+		__m256i second = _mm256_shuffle_epi8(symbols, _mm256_unpackhi_epi8(high, low));		// words 2, 3 | 6, 7
+
+		if (stride == WORD_DIGITS) {
+
+			_mm256_storeu_si256((__m256i*)(text + i * WORD_DIGITS), _mm256_permute2x128_si256(first, second, 0x20));
+			_mm256_storeu_si256((__m256i*)(text + i * WORD_DIGITS + 32), _mm256_permute2x128_si256(first, second, 0x31));
+		}
+		else {
+
+			__m128i words01 = _mm256_castsi256_si128(first);
+			__m128i words23 = _mm256_castsi256_si128(second);
+			__m128i words45 = _mm256_extracti128_si256(first, 1);
+			__m128i words67 = _mm256_extracti128_si256(second, 1);
+
+			_mm_storel_epi64((__m128i*)(text + i * stride), words01);
+			_mm_storel_epi64((__m128i*)(text + (i + 1) * stride), _mm_srli_si128(words01, 8));
+			_mm_storel_epi64((__m128i*)(text + (i + 2) * stride), words23);
+			_mm_storel_epi64((__m128i*)(text + (i + 3) * stride), _mm_srli_si128(words23, 8));
+			_mm_storel_epi64((__m128i*)(text + (i + 4) * stride), words45);
+			_mm_storel_epi64((__m128i*)(text + (i + 5) * stride), _mm_srli_si128(words45, 8));
+			_mm_storel_epi64((__m128i*)(text + (i + 6) * stride), words67);
+			_mm_storel_epi64((__m128i*)(text + (i + 7) * stride), _mm_srli_si128(words67, 8));
+		}
+	}
+
+	encode_words_sse2(text + i * stride, words + i, count - i, stride, uppercase);
+}
+
+AVX2_TARGET static size_t decode_lines_avx2(uint32_t* words, const char* text, size_t count) {
+
+	const __m256i bswap = _mm256_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12, 3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+	size_t i;
+
+	for (i = 0; i + 4 <= count; i += 4) {
+
+		const char* line = text + i * LINE_STRIDE;
+		__m128i lines01, lines23;
+		__m256i c, lower, digit, letter, nibbles, bytes;
+
+		if (line[WORD_DIGITS] != '\n' || line[LINE_STRIDE + WORD_DIGITS] != '\n' || line[2 * LINE_STRIDE + WORD_DIGITS] != '\n' || line[3 * LINE_STRIDE + WORD_DIGITS] != '\n') {
+			break;
+		}
+
+		lines01 = _mm_unpacklo_epi64(_mm_loadl_epi64((const __m128i*)line), _mm_loadl_epi64((const __m128i*)(line + LINE_STRIDE)));
+		lines23 = _mm_unpacklo_epi64(_mm_loadl_epi64((const __m128i*)(line + 2 * LINE_STRIDE)), _mm_loadl_epi64((const __m128i*)(line + 3 * LINE_STRIDE)));
+		c = _mm256_inserti128_si256(_mm256_castsi128_si256(lines01), lines23, 1);
+
+		lower = _mm256_or_si256(c, _mm256_set1_epi8(0x20));
+		digit = _mm256_and_si256(_mm256_cmpgt_epi8(c, _mm256_set1_epi8('0' - 1)), _mm256_cmpgt_epi8(_mm256_set1_epi8('9' + 1), c));
+		letter = _mm256_and_si256(_mm256_cmpgt_epi8(lower, _mm256_set1_epi8('a' - 1)), _mm256_cmpgt_epi8(_mm256_set1_epi8('f' + 1), lower));
+
+		if (_mm256_movemask_epi8(_mm256_or_si256(digit, letter)) != -1) {
+			break;
+		}
+
+		nibbles = _mm256_blendv_epi8(_mm256_sub_epi8(lower, _mm256_set1_epi8('a' - 10)), _mm256_sub_epi8(c, _mm256_set1_epi8('0')), digit);
+		bytes = _mm256_and_si256(_mm256_or_si256(_mm256_slli_epi16(nibbles, 4), _mm256_srli_epi16(nibbles, 8)), _mm256_set1_epi16(0x00FF));
+		bytes = _mm256_shuffle_epi8(_mm256_packus_epi16(bytes, bytes), bswap);
+
+		_mm_storeu_si128((__m128i*)(words + i), _mm256_castsi256_si128(_mm256_permute4x64_epi64(bytes, _MM_SHUFFLE(3, 1, 2, 0))));
+	}
+
+	return i + decode_lines_sse2(words + i, text + i * LINE_STRIDE, count - i);
+}
+
+static int avx2_supported(void) {
+
+	static int supported = -1;
+
+	if (supported < 0) {
+
+#ifdef _MSC_VER
+		int info[4];
+
+		supported = 0;
+		__cpuid(info, 0);
+
+		if (info[0] >= 7) {
+
+			__cpuid(info, 1);
+
+			if ((info[2] & (1 << 27)) && (info[2] & (1 << 28)) && (_xgetbv(0) & 6) == 6) {		// osxsave, avx, ymm state enabled.
+
+				__cpuidex(info, 7, 0);
+				supported = (info[1] & (1 << 5)) != 0;
+			}
+		}
+#else
+		__builtin_cpu_init();
+		supported = __builtin_cpu_supports("avx2") != 0;
+#endif
+	}
+
+	return supported;
+}
+
+#endif
+
+/*
+  description:
+	writes words[i] as 8 hex digits at text + i * stride. the characters between words are left alone, so separators
+	can be written beforehand.
+
+*/
+void hex_encode_words(char* text, const uint32_t* words, size_t count, size_t stride, int uppercase) {
+
+#ifdef HEX_SIMD
+	if (avx2_supported())
+		encode_words_avx2(text, words, count, stride, uppercase);
+	else
+		encode_words_sse2(text, words, count, stride, uppercase);
+#else
+	encode_words_scalar(text, words, count, stride, uppercase);
+#endif
+}
+
+/*
+  description:
+	decodes up to count lines of exactly 8 hex digits and '\n', count * 9 characters of text.
+	returns the number of lines decoded, stopping before the first line that doesn't have that form.
+
+*/
+size_t hex_decode_lines(uint32_t* words, const char* text, size_t count) {
+
+#ifdef HEX_SIMD
+	if (avx2_supported())
+		return decode_lines_avx2(words, text, count);
+	else
+		return decode_lines_sse2(words, text, count);
+#else
+	return decode_lines_scalar(words, text, count);
+#endif
+}
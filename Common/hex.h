@@ -0,0 +1,23 @@
+#ifndef __HEX_H__
+#define __HEX_H__
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+  description:
+	hex conversions shared by the assembler and the simulator.
+
+	hex_parse and hex_format convert a single value. hex_encode_words and hex_decode_lines convert 8 digit words in
+	bulk, with AVX2 kernels when the processor has it, SSE2 kernels otherwise on x86 and x64, and the scalar code
+	everywhere else. building with SIMP_NO_SIMD keeps everything scalar.
+
+*/
+
+uint32_t hex_parse(const char* text, int digits);
+void hex_format(char* hex, uint32_t value, int digits, int uppercase);
+
+void hex_encode_words(char* text, const uint32_t* words, size_t count, size_t stride, int uppercase);
+size_t hex_decode_lines(uint32_t* words, const char* text, size_t count);
+
+#endif
@@ -0,0 +1,17 @@
+	add $t0, $zero, $imm1, $zero, 1, 0		# x = 1
+	add $t1, $zero, $imm1, $zero, 1234, 0		# y = 1234
+	add $v0, $zero, $zero, $zero, 0, 0		# bits = 0
+	sll $s0, $imm1, $imm2, $zero, 25, 13		# 25 << 13 = 204800 passes
+loop:
+	mac $t0, $t0, $imm1, $t1, 33, 0			# x = x * 33 - y
+	xor $t1, $t1, $t0, $zero, 0, 0			# y = y ^ x
+	srl $t2, $t0, $imm1, $zero, 7, 0		# x >> 7
+	add $t1, $t1, $t2, $imm1, 1, 0			# y = y + (x >> 7) + 1
+	and $t2, $t0, $t1, $imm1, 0x7ff, 0		# x & y & 0x7ff
+	or $v0, $v0, $t2, $zero, 0, 0			# bits = bits | (x & y & 0x7ff)
+	sub $s0, $s0, $imm1, $zero, 1, 0		# one pass less
+	bne $zero, $s0, $zero, $imm2, 0, loop		# loop while passes remain
+	sw $zero, $zero, $imm2, $t0, 0, 256		# store x in 256
+	sw $zero, $zero, $imm2, $t1, 0, 257		# store y in 257
+	sw $zero, $zero, $imm2, $v0, 0, 258		# store bits in 258
+	halt $zero, $zero, $zero, $zero, 0, 0		# halt
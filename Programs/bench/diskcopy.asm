@@ -0,0 +1,31 @@
+	sll $a0, $imm1, $imm2, $zero, 1, 10		# buffer = 1 << 10 = 1024
+	out $zero, $zero, $imm2, $a0, 0, 16		# diskbuffer = buffer
+	add $s0, $zero, $zero, $zero, 0, 0		# sector = 0
+fill:
+	add $t0, $zero, $zero, $zero, 0, 0		# i = 0
+pattern:
+	mac $t1, $s0, $imm1, $t0, 256, 0		# sector * 256 - i
+	sw $zero, $a0, $t0, $t1, 0, 0			# buffer[i] = sector * 256 - i
+	add $t0, $t0, $imm1, $zero, 1, 0		# i++
+	blt $zero, $t0, $imm1, $imm2, 128, pattern	# loop while i < 128
+	out $zero, $zero, $imm2, $s0, 0, 15		# disksector = sector
+	out $zero, $zero, $imm2, $imm1, 2, 14		# diskcmd = write
+	jal $ra, $zero, $zero, $imm2, 0, wait		# wait for the disk
+	add $s0, $s0, $imm1, $zero, 1, 0		# sector++
+	blt $zero, $s0, $imm1, $imm2, 32, fill		# loop while sector < 32
+	add $s0, $zero, $zero, $zero, 0, 0		# sector = 0
+copy:
+	out $zero, $zero, $imm2, $s0, 0, 15		# disksector = sector
+	out $zero, $zero, $imm2, $imm1, 1, 14		# diskcmd = read
+	jal $ra, $zero, $zero, $imm2, 0, wait		# wait for the disk
+	add $t0, $s0, $imm1, $zero, 64, 0		# sector + 64
+	out $zero, $zero, $imm2, $t0, 0, 15		# disksector = sector + 64
+	out $zero, $zero, $imm2, $imm1, 2, 14		# diskcmd = write
+	jal $ra, $zero, $zero, $imm2, 0, wait		# wait for the disk
+	add $s0, $s0, $imm1, $zero, 1, 0		# sector++
+	blt $zero, $s0, $imm1, $imm2, 32, copy		# loop while sector < 32
+	halt $zero, $zero, $zero, $zero, 0, 0		# halt
+wait:
+	in $t1, $zero, $imm2, $zero, 0, 17		# diskstatus
+	bne $zero, $t1, $zero, $imm2, 0, wait		# loop while the disk is busy
+	beq $zero, $zero, $zero, $ra, 0, 0		# return
@@ -0,0 +1,41 @@
+	sll $a0, $imm1, $imm2, $zero, 1, 10		# A = 1 << 10 = 1024, 16 x 16 words
+	add $a1, $a0, $imm1, $zero, 256, 0		# B = 1280
+	add $a2, $a1, $imm1, $zero, 256, 0		# C = 1536
+	add $gp, $zero, $imm1, $zero, 16, 0		# n = 16
+	add $t0, $zero, $zero, $zero, 0, 0		# k = 0
+init:
+	and $t1, $t0, $imm1, $imm1, 15, 0		# k & 15
+	add $t1, $t1, $imm1, $zero, 1, 0		# (k & 15) + 1
+	sw $zero, $a0, $t0, $t1, 0, 0			# A[k] = (k & 15) + 1
+	srl $t2, $t0, $imm1, $zero, 4, 0		# k >> 4
+	sub $t2, $imm1, $t2, $zero, 8, 0		# 8 - (k >> 4)
+	sw $zero, $a1, $t0, $t2, 0, 0			# B[k] = 8 - (k >> 4)
+	add $t0, $t0, $imm1, $zero, 1, 0		# k++
+	blt $zero, $t0, $imm1, $imm2, 256, init		# loop while k < n * n
+	add $v0, $zero, $imm1, $zero, 16, 0		# 16 products
+repeat:
+	add $s0, $zero, $zero, $zero, 0, 0		# i * n = 0
+row:
+	add $s1, $zero, $zero, $zero, 0, 0		# j = 0
+column:
+	add $t2, $zero, $zero, $zero, 0, 0		# sum = 0
+	add $t0, $a0, $s0, $zero, 0, 0			# &A[i][0]
+	add $ra, $a1, $s1, $zero, 0, 0			# &B[0][j]
+	add $s2, $zero, $zero, $zero, 0, 0		# k = 0
+dot:
+	lw $t1, $t0, $s2, $zero, 0, 0			# A[i][k]
+	lw $sp, $ra, $zero, $zero, 0, 0			# B[k][j]
+	mac $t1, $t1, $sp, $zero, 0, 0			# A[i][k] * B[k][j]
+	add $t2, $t2, $t1, $zero, 0, 0			# sum += A[i][k] * B[k][j]
+	add $ra, $ra, $gp, $zero, 0, 0			# &B[k + 1][j]
+	add $s2, $s2, $imm1, $zero, 1, 0		# k++
+	blt $zero, $s2, $gp, $imm2, 0, dot		# loop while k < n
+	add $t1, $a2, $s0, $s1, 0, 0			# &C[i][j]
+	sw $zero, $t1, $zero, $t2, 0, 0			# C[i][j] = sum
+	add $s1, $s1, $imm1, $zero, 1, 0		# j++
+	blt $zero, $s1, $gp, $imm2, 0, column		# loop while j < n
+	add $s0, $s0, $gp, $zero, 0, 0			# (i + 1) * n
+	blt $zero, $s0, $imm1, $imm2, 256, row		# loop while i < n
+	sub $v0, $v0, $imm1, $zero, 1, 0		# one product less
+	bgt $zero, $v0, $zero, $imm2, 0, repeat		# multiply again while products remain
+	halt $zero, $zero, $zero, $zero, 0, 0		# halt
@@ -0,0 +1,19 @@
+	sll $s0, $imm1, $imm2, $zero, 1, 10		# src = n = 1 << 10 = 1024
+	sll $s1, $imm1, $imm2, $zero, 1, 11		# dst = 1 << 11 = 2048
+	add $t0, $zero, $zero, $zero, 0, 0		# i = 0
+fill:
+	mac $t1, $t0, $imm1, $zero, 7, 0		# i * 7
+	sw $zero, $s0, $t0, $t1, 0, 0			# src[i] = i * 7
+	add $t0, $t0, $imm1, $zero, 1, 0		# i++
+	blt $zero, $t0, $s0, $imm2, 0, fill		# loop while i < n
+	add $s2, $zero, $imm1, $zero, 128, 0		# 128 copies
+pass:
+	add $t0, $zero, $zero, $zero, 0, 0		# i = 0
+copy:
+	lw $t1, $s0, $t0, $zero, 0, 0			# src[i]
+	sw $zero, $s1, $t0, $t1, 0, 0			# dst[i] = src[i]
+	add $t0, $t0, $imm1, $zero, 1, 0		# i++
+	blt $zero, $t0, $s0, $imm2, 0, copy		# loop while i < n
+	sub $s2, $s2, $imm1, $zero, 1, 0		# one copy less
+	bgt $zero, $s2, $zero, $imm2, 0, pass		# copy again while copies remain
+	halt $zero, $zero, $zero, $zero, 0, 0		# halt
@@ -0,0 +1,12 @@
+	add $t0, $zero, $zero, $zero, 0, 0		# pixel = 0
+	sll $s0, $imm1, $imm2, $zero, 1, 16		# 1 << 16 = 65536 pixels
+draw:
+	srl $t1, $t0, $imm1, $zero, 8, 0		# y = pixel >> 8
+	xor $t2, $t0, $t1, $zero, 0, 0			# x ^ y in the low byte
+	and $t2, $t2, $imm1, $imm1, 255, 0		# (x ^ y) & 255
+	out $zero, $zero, $imm2, $t0, 0, 20		# monitoraddr = pixel
+	out $zero, $zero, $imm2, $t2, 0, 21		# monitordata = (x ^ y) & 255
+	out $zero, $zero, $imm2, $imm1, 1, 22		# monitorcmd = write
+	add $t0, $t0, $imm1, $zero, 1, 0		# pixel++
+	blt $zero, $t0, $s0, $imm2, 0, draw		# loop while pixel < 65536
+	halt $zero, $zero, $zero, $zero, 0, 0		# halt
@@ -0,0 +1,25 @@
+	sll $sp, $imm1, $imm2, $zero, 1, 11		# set $sp = 1 << 11 = 2048
+	add $a0, $zero, $imm1, $zero, 22, 0		# n = 22
+	jal $ra, $zero, $zero, $imm2, 0, fib		# calc $v0 = fib(n)
+	sw $zero, $zero, $imm2, $v0, 0, 256		# store fib(n) in 256
+	halt $zero, $zero, $zero, $zero, 0, 0		# halt
+fib:
+	bgt $zero, $a0, $imm1, $imm2, 1, recurse	# recurse if n > 1
+	add $v0, $a0, $zero, $zero, 0, 0		# otherwise, fib(n) = n
+	beq $zero, $zero, $zero, $ra, 0, 0		# return
+recurse:
+	sub $sp, $sp, $imm1, $zero, 3, 0		# adjust stack for 3 items
+	sw $zero, $sp, $imm1, $ra, 0, 0			# save return address
+	sw $zero, $sp, $imm1, $a0, 1, 0			# save n
+	sw $zero, $sp, $imm1, $s0, 2, 0			# save $s0
+	sub $a0, $a0, $imm1, $zero, 1, 0		# n - 1
+	jal $ra, $zero, $zero, $imm2, 0, fib		# calc $v0 = fib(n - 1)
+	add $s0, $v0, $zero, $zero, 0, 0		# $s0 = fib(n - 1)
+	lw $a0, $sp, $imm1, $zero, 1, 0			# restore n
+	sub $a0, $a0, $imm1, $zero, 2, 0		# n - 2
+	jal $ra, $zero, $zero, $imm2, 0, fib		# calc $v0 = fib(n - 2)
+	add $v0, $v0, $s0, $zero, 0, 0			# fib(n) = fib(n - 1) + fib(n - 2)
+	lw $ra, $sp, $imm1, $zero, 0, 0			# restore return address
+	lw $s0, $sp, $imm1, $zero, 2, 0			# restore $s0
+	add $sp, $sp, $imm1, $zero, 3, 0		# pop 3 items
+	beq $zero, $zero, $zero, $ra, 0, 0		# return
@@ -0,0 +1,26 @@
+	sll $a0, $imm1, $imm2, $zero, 1, 10		# array = 1 << 10 = 1024
+	add $a1, $zero, $imm1, $zero, 384, 0		# n = 384
+	add $t0, $zero, $zero, $zero, 0, 0		# i = 0
+	add $t1, $zero, $imm1, $zero, 1, 0		# x = 1
+fill:
+	mac $t1, $t1, $imm1, $imm2, 37, -11		# x = x * 37 + 11
+	and $t1, $t1, $imm1, $imm1, 0x7ff, 0		# x = x & 0x7ff
+	sw $zero, $a0, $t0, $t1, 0, 0			# a[i] = x
+	add $t0, $t0, $imm1, $zero, 1, 0		# i++
+	blt $zero, $t0, $a1, $imm2, 0, fill		# loop while i < n
+	sub $s0, $a1, $imm1, $zero, 1, 0		# last = n - 1
+outer:
+	add $t0, $zero, $zero, $zero, 0, 0		# i = 0
+inner:
+	add $t2, $a0, $t0, $zero, 0, 0			# &a[i]
+	lw $t1, $t2, $zero, $zero, 0, 0			# a[i]
+	lw $s2, $t2, $imm1, $zero, 1, 0			# a[i + 1]
+	ble $zero, $t1, $s2, $imm2, 0, ordered		# skip the swap if a[i] <= a[i + 1]
+	sw $zero, $t2, $zero, $s2, 0, 0			# a[i] = a[i + 1]
+	sw $zero, $t2, $imm1, $t1, 1, 0			# a[i + 1] = a[i]
+ordered:
+	add $t0, $t0, $imm1, $zero, 1, 0		# i++
+	blt $zero, $t0, $s0, $imm2, 0, inner		# loop while i < last
+	sub $s0, $s0, $imm1, $zero, 1, 0		# last--
+	bgt $zero, $s0, $zero, $imm2, 0, outer		# bubble again while last > 0
+	halt $zero, $zero, $zero, $zero, 0, 0		# halt
@@ -0,0 +1,16 @@
+	out $zero, $imm1, $zero, $imm2, 6, handler	# set irqhandler as handler
+	out $zero, $zero, $imm2, $imm1, 15, 13		# timermax = 15, an irq0 every 16 cycles
+	out $zero, $zero, $imm2, $imm1, 1, 0		# enable irq0
+	out $zero, $zero, $imm2, $imm1, 1, 11		# enable the timer
+	sll $s0, $imm1, $imm2, $zero, 10, 12		# wait for 10 << 12 = 40960 interrupts
+wait:
+	add $t1, $t1, $imm1, $zero, 1, 0		# count the passes of the wait loop
+	blt $zero, $s1, $s0, $imm2, 0, wait		# loop while interrupts remain
+	out $zero, $zero, $imm2, $zero, 0, 11		# disable the timer
+	sw $zero, $zero, $imm2, $s1, 0, 256		# store the interrupts in 256
+	sw $zero, $zero, $imm2, $t1, 0, 257		# store the passes in 257
+	halt $zero, $zero, $zero, $zero, 0, 0		# halt
+handler:
+	add $s1, $s1, $imm1, $zero, 1, 0		# count the interrupt
+	out $zero, $zero, $imm2, $zero, 0, 3		# clear irq0status
+	reti $zero, $zero, $zero, $zero, 0, 0		# return from the interrupt
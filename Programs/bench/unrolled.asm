@@ -0,0 +1,6123 @@
+	add $t0, $zero, $zero, $zero, 0, 0		# h = 0, a rolling hash of words 0 to 2039 unrolled to fill imem
+	lw $t1, $zero, $imm1, $zero, 0, 0		# word 0
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1, 0		# word 1
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 2, 0		# word 2
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 3, 0		# word 3
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 4, 0		# word 4
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 5, 0		# word 5
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 6, 0		# word 6
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 7, 0		# word 7
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 8, 0		# word 8
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 9, 0		# word 9
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 10, 0		# word 10
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 11, 0		# word 11
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 12, 0		# word 12
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 13, 0		# word 13
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 14, 0		# word 14
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 15, 0		# word 15
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 16, 0		# word 16
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 17, 0		# word 17
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 18, 0		# word 18
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 19, 0		# word 19
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 20, 0		# word 20
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 21, 0		# word 21
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 22, 0		# word 22
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 23, 0		# word 23
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 24, 0		# word 24
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 25, 0		# word 25
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 26, 0		# word 26
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 27, 0		# word 27
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 28, 0		# word 28
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 29, 0		# word 29
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 30, 0		# word 30
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 31, 0		# word 31
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 32, 0		# word 32
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 33, 0		# word 33
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 34, 0		# word 34
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 35, 0		# word 35
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 36, 0		# word 36
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 37, 0		# word 37
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 38, 0		# word 38
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 39, 0		# word 39
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 40, 0		# word 40
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 41, 0		# word 41
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 42, 0		# word 42
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 43, 0		# word 43
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 44, 0		# word 44
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 45, 0		# word 45
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 46, 0		# word 46
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 47, 0		# word 47
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 48, 0		# word 48
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 49, 0		# word 49
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 50, 0		# word 50
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 51, 0		# word 51
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 52, 0		# word 52
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 53, 0		# word 53
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 54, 0		# word 54
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 55, 0		# word 55
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 56, 0		# word 56
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 57, 0		# word 57
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 58, 0		# word 58
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 59, 0		# word 59
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 60, 0		# word 60
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 61, 0		# word 61
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 62, 0		# word 62
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 63, 0		# word 63
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 64, 0		# word 64
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 65, 0		# word 65
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 66, 0		# word 66
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 67, 0		# word 67
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 68, 0		# word 68
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 69, 0		# word 69
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 70, 0		# word 70
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 71, 0		# word 71
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 72, 0		# word 72
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 73, 0		# word 73
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 74, 0		# word 74
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 75, 0		# word 75
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 76, 0		# word 76
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 77, 0		# word 77
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 78, 0		# word 78
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 79, 0		# word 79
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 80, 0		# word 80
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 81, 0		# word 81
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 82, 0		# word 82
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 83, 0		# word 83
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 84, 0		# word 84
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 85, 0		# word 85
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 86, 0		# word 86
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 87, 0		# word 87
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 88, 0		# word 88
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 89, 0		# word 89
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 90, 0		# word 90
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 91, 0		# word 91
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 92, 0		# word 92
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 93, 0		# word 93
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 94, 0		# word 94
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 95, 0		# word 95
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 96, 0		# word 96
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 97, 0		# word 97
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 98, 0		# word 98
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 99, 0		# word 99
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 100, 0		# word 100
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 101, 0		# word 101
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 102, 0		# word 102
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 103, 0		# word 103
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 104, 0		# word 104
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 105, 0		# word 105
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 106, 0		# word 106
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 107, 0		# word 107
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 108, 0		# word 108
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 109, 0		# word 109
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 110, 0		# word 110
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 111, 0		# word 111
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 112, 0		# word 112
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 113, 0		# word 113
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 114, 0		# word 114
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 115, 0		# word 115
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 116, 0		# word 116
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 117, 0		# word 117
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 118, 0		# word 118
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 119, 0		# word 119
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 120, 0		# word 120
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 121, 0		# word 121
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 122, 0		# word 122
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 123, 0		# word 123
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 124, 0		# word 124
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 125, 0		# word 125
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 126, 0		# word 126
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 127, 0		# word 127
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 128, 0		# word 128
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 129, 0		# word 129
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 130, 0		# word 130
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 131, 0		# word 131
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 132, 0		# word 132
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 133, 0		# word 133
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 134, 0		# word 134
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 135, 0		# word 135
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 136, 0		# word 136
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 137, 0		# word 137
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 138, 0		# word 138
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 139, 0		# word 139
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 140, 0		# word 140
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 141, 0		# word 141
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 142, 0		# word 142
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 143, 0		# word 143
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 144, 0		# word 144
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 145, 0		# word 145
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 146, 0		# word 146
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 147, 0		# word 147
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 148, 0		# word 148
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 149, 0		# word 149
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 150, 0		# word 150
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 151, 0		# word 151
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 152, 0		# word 152
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 153, 0		# word 153
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 154, 0		# word 154
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 155, 0		# word 155
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 156, 0		# word 156
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 157, 0		# word 157
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 158, 0		# word 158
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 159, 0		# word 159
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 160, 0		# word 160
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 161, 0		# word 161
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 162, 0		# word 162
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 163, 0		# word 163
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 164, 0		# word 164
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 165, 0		# word 165
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 166, 0		# word 166
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 167, 0		# word 167
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 168, 0		# word 168
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 169, 0		# word 169
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 170, 0		# word 170
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 171, 0		# word 171
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 172, 0		# word 172
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 173, 0		# word 173
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 174, 0		# word 174
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 175, 0		# word 175
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 176, 0		# word 176
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 177, 0		# word 177
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 178, 0		# word 178
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 179, 0		# word 179
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 180, 0		# word 180
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 181, 0		# word 181
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 182, 0		# word 182
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 183, 0		# word 183
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 184, 0		# word 184
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 185, 0		# word 185
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 186, 0		# word 186
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 187, 0		# word 187
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 188, 0		# word 188
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 189, 0		# word 189
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 190, 0		# word 190
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 191, 0		# word 191
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 192, 0		# word 192
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 193, 0		# word 193
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 194, 0		# word 194
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 195, 0		# word 195
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 196, 0		# word 196
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 197, 0		# word 197
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 198, 0		# word 198
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 199, 0		# word 199
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 200, 0		# word 200
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 201, 0		# word 201
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 202, 0		# word 202
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 203, 0		# word 203
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 204, 0		# word 204
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 205, 0		# word 205
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 206, 0		# word 206
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 207, 0		# word 207
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 208, 0		# word 208
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 209, 0		# word 209
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 210, 0		# word 210
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 211, 0		# word 211
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 212, 0		# word 212
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 213, 0		# word 213
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 214, 0		# word 214
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 215, 0		# word 215
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 216, 0		# word 216
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 217, 0		# word 217
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 218, 0		# word 218
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 219, 0		# word 219
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 220, 0		# word 220
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 221, 0		# word 221
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 222, 0		# word 222
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 223, 0		# word 223
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 224, 0		# word 224
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 225, 0		# word 225
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 226, 0		# word 226
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 227, 0		# word 227
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 228, 0		# word 228
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 229, 0		# word 229
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 230, 0		# word 230
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 231, 0		# word 231
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 232, 0		# word 232
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 233, 0		# word 233
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 234, 0		# word 234
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 235, 0		# word 235
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 236, 0		# word 236
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 237, 0		# word 237
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 238, 0		# word 238
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 239, 0		# word 239
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 240, 0		# word 240
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 241, 0		# word 241
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 242, 0		# word 242
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 243, 0		# word 243
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 244, 0		# word 244
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 245, 0		# word 245
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 246, 0		# word 246
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 247, 0		# word 247
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 248, 0		# word 248
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 249, 0		# word 249
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 250, 0		# word 250
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 251, 0		# word 251
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 252, 0		# word 252
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 253, 0		# word 253
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 254, 0		# word 254
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 255, 0		# word 255
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 256, 0		# word 256
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 257, 0		# word 257
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 258, 0		# word 258
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 259, 0		# word 259
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 260, 0		# word 260
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 261, 0		# word 261
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 262, 0		# word 262
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 263, 0		# word 263
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 264, 0		# word 264
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 265, 0		# word 265
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 266, 0		# word 266
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 267, 0		# word 267
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 268, 0		# word 268
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 269, 0		# word 269
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 270, 0		# word 270
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 271, 0		# word 271
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 272, 0		# word 272
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 273, 0		# word 273
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 274, 0		# word 274
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 275, 0		# word 275
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 276, 0		# word 276
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 277, 0		# word 277
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 278, 0		# word 278
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 279, 0		# word 279
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 280, 0		# word 280
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 281, 0		# word 281
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 282, 0		# word 282
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 283, 0		# word 283
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 284, 0		# word 284
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 285, 0		# word 285
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 286, 0		# word 286
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 287, 0		# word 287
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 288, 0		# word 288
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 289, 0		# word 289
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 290, 0		# word 290
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 291, 0		# word 291
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 292, 0		# word 292
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 293, 0		# word 293
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 294, 0		# word 294
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 295, 0		# word 295
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 296, 0		# word 296
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 297, 0		# word 297
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 298, 0		# word 298
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 299, 0		# word 299
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 300, 0		# word 300
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 301, 0		# word 301
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 302, 0		# word 302
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 303, 0		# word 303
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 304, 0		# word 304
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 305, 0		# word 305
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 306, 0		# word 306
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 307, 0		# word 307
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 308, 0		# word 308
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 309, 0		# word 309
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 310, 0		# word 310
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 311, 0		# word 311
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 312, 0		# word 312
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 313, 0		# word 313
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 314, 0		# word 314
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 315, 0		# word 315
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 316, 0		# word 316
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 317, 0		# word 317
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 318, 0		# word 318
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 319, 0		# word 319
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 320, 0		# word 320
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 321, 0		# word 321
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 322, 0		# word 322
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 323, 0		# word 323
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 324, 0		# word 324
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 325, 0		# word 325
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 326, 0		# word 326
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 327, 0		# word 327
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 328, 0		# word 328
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 329, 0		# word 329
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 330, 0		# word 330
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 331, 0		# word 331
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 332, 0		# word 332
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 333, 0		# word 333
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 334, 0		# word 334
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 335, 0		# word 335
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 336, 0		# word 336
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 337, 0		# word 337
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 338, 0		# word 338
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 339, 0		# word 339
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 340, 0		# word 340
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 341, 0		# word 341
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 342, 0		# word 342
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 343, 0		# word 343
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 344, 0		# word 344
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 345, 0		# word 345
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 346, 0		# word 346
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 347, 0		# word 347
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 348, 0		# word 348
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 349, 0		# word 349
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 350, 0		# word 350
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 351, 0		# word 351
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 352, 0		# word 352
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 353, 0		# word 353
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 354, 0		# word 354
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 355, 0		# word 355
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 356, 0		# word 356
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 357, 0		# word 357
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 358, 0		# word 358
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 359, 0		# word 359
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 360, 0		# word 360
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 361, 0		# word 361
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 362, 0		# word 362
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 363, 0		# word 363
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 364, 0		# word 364
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 365, 0		# word 365
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 366, 0		# word 366
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 367, 0		# word 367
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 368, 0		# word 368
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 369, 0		# word 369
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 370, 0		# word 370
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 371, 0		# word 371
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 372, 0		# word 372
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 373, 0		# word 373
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 374, 0		# word 374
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 375, 0		# word 375
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 376, 0		# word 376
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 377, 0		# word 377
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 378, 0		# word 378
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 379, 0		# word 379
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 380, 0		# word 380
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 381, 0		# word 381
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 382, 0		# word 382
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 383, 0		# word 383
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 384, 0		# word 384
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 385, 0		# word 385
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 386, 0		# word 386
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 387, 0		# word 387
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 388, 0		# word 388
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 389, 0		# word 389
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 390, 0		# word 390
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 391, 0		# word 391
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 392, 0		# word 392
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 393, 0		# word 393
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 394, 0		# word 394
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 395, 0		# word 395
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 396, 0		# word 396
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 397, 0		# word 397
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 398, 0		# word 398
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 399, 0		# word 399
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 400, 0		# word 400
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 401, 0		# word 401
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 402, 0		# word 402
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 403, 0		# word 403
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 404, 0		# word 404
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 405, 0		# word 405
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 406, 0		# word 406
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 407, 0		# word 407
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 408, 0		# word 408
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 409, 0		# word 409
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 410, 0		# word 410
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 411, 0		# word 411
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 412, 0		# word 412
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 413, 0		# word 413
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 414, 0		# word 414
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 415, 0		# word 415
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 416, 0		# word 416
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 417, 0		# word 417
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 418, 0		# word 418
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 419, 0		# word 419
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 420, 0		# word 420
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 421, 0		# word 421
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 422, 0		# word 422
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 423, 0		# word 423
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 424, 0		# word 424
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 425, 0		# word 425
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 426, 0		# word 426
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 427, 0		# word 427
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 428, 0		# word 428
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 429, 0		# word 429
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 430, 0		# word 430
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 431, 0		# word 431
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 432, 0		# word 432
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 433, 0		# word 433
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 434, 0		# word 434
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 435, 0		# word 435
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 436, 0		# word 436
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 437, 0		# word 437
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 438, 0		# word 438
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 439, 0		# word 439
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 440, 0		# word 440
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 441, 0		# word 441
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 442, 0		# word 442
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 443, 0		# word 443
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 444, 0		# word 444
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 445, 0		# word 445
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 446, 0		# word 446
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 447, 0		# word 447
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 448, 0		# word 448
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 449, 0		# word 449
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 450, 0		# word 450
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 451, 0		# word 451
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 452, 0		# word 452
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 453, 0		# word 453
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 454, 0		# word 454
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 455, 0		# word 455
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 456, 0		# word 456
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 457, 0		# word 457
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 458, 0		# word 458
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 459, 0		# word 459
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 460, 0		# word 460
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 461, 0		# word 461
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 462, 0		# word 462
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 463, 0		# word 463
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 464, 0		# word 464
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 465, 0		# word 465
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 466, 0		# word 466
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 467, 0		# word 467
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 468, 0		# word 468
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 469, 0		# word 469
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 470, 0		# word 470
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 471, 0		# word 471
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 472, 0		# word 472
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 473, 0		# word 473
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 474, 0		# word 474
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 475, 0		# word 475
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 476, 0		# word 476
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 477, 0		# word 477
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 478, 0		# word 478
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 479, 0		# word 479
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 480, 0		# word 480
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 481, 0		# word 481
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 482, 0		# word 482
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 483, 0		# word 483
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 484, 0		# word 484
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 485, 0		# word 485
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 486, 0		# word 486
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 487, 0		# word 487
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 488, 0		# word 488
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 489, 0		# word 489
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 490, 0		# word 490
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 491, 0		# word 491
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 492, 0		# word 492
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 493, 0		# word 493
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 494, 0		# word 494
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 495, 0		# word 495
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 496, 0		# word 496
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 497, 0		# word 497
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 498, 0		# word 498
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 499, 0		# word 499
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 500, 0		# word 500
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 501, 0		# word 501
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 502, 0		# word 502
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 503, 0		# word 503
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 504, 0		# word 504
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 505, 0		# word 505
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 506, 0		# word 506
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 507, 0		# word 507
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 508, 0		# word 508
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 509, 0		# word 509
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 510, 0		# word 510
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 511, 0		# word 511
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 512, 0		# word 512
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 513, 0		# word 513
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 514, 0		# word 514
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 515, 0		# word 515
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 516, 0		# word 516
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 517, 0		# word 517
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 518, 0		# word 518
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 519, 0		# word 519
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 520, 0		# word 520
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 521, 0		# word 521
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 522, 0		# word 522
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 523, 0		# word 523
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 524, 0		# word 524
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 525, 0		# word 525
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 526, 0		# word 526
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 527, 0		# word 527
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 528, 0		# word 528
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 529, 0		# word 529
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 530, 0		# word 530
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 531, 0		# word 531
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 532, 0		# word 532
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 533, 0		# word 533
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 534, 0		# word 534
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 535, 0		# word 535
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 536, 0		# word 536
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 537, 0		# word 537
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 538, 0		# word 538
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 539, 0		# word 539
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 540, 0		# word 540
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 541, 0		# word 541
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 542, 0		# word 542
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 543, 0		# word 543
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 544, 0		# word 544
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 545, 0		# word 545
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 546, 0		# word 546
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 547, 0		# word 547
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 548, 0		# word 548
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 549, 0		# word 549
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 550, 0		# word 550
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 551, 0		# word 551
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 552, 0		# word 552
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 553, 0		# word 553
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 554, 0		# word 554
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 555, 0		# word 555
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 556, 0		# word 556
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 557, 0		# word 557
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 558, 0		# word 558
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 559, 0		# word 559
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 560, 0		# word 560
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 561, 0		# word 561
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 562, 0		# word 562
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 563, 0		# word 563
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 564, 0		# word 564
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 565, 0		# word 565
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 566, 0		# word 566
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 567, 0		# word 567
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 568, 0		# word 568
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 569, 0		# word 569
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 570, 0		# word 570
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 571, 0		# word 571
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 572, 0		# word 572
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 573, 0		# word 573
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 574, 0		# word 574
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 575, 0		# word 575
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 576, 0		# word 576
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 577, 0		# word 577
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 578, 0		# word 578
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 579, 0		# word 579
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 580, 0		# word 580
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 581, 0		# word 581
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 582, 0		# word 582
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 583, 0		# word 583
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 584, 0		# word 584
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 585, 0		# word 585
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 586, 0		# word 586
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 587, 0		# word 587
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 588, 0		# word 588
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 589, 0		# word 589
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 590, 0		# word 590
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 591, 0		# word 591
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 592, 0		# word 592
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 593, 0		# word 593
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 594, 0		# word 594
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 595, 0		# word 595
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 596, 0		# word 596
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 597, 0		# word 597
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 598, 0		# word 598
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 599, 0		# word 599
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 600, 0		# word 600
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 601, 0		# word 601
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 602, 0		# word 602
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 603, 0		# word 603
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 604, 0		# word 604
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 605, 0		# word 605
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 606, 0		# word 606
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 607, 0		# word 607
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 608, 0		# word 608
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 609, 0		# word 609
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 610, 0		# word 610
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 611, 0		# word 611
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 612, 0		# word 612
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 613, 0		# word 613
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 614, 0		# word 614
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 615, 0		# word 615
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 616, 0		# word 616
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 617, 0		# word 617
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 618, 0		# word 618
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 619, 0		# word 619
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 620, 0		# word 620
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 621, 0		# word 621
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 622, 0		# word 622
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 623, 0		# word 623
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 624, 0		# word 624
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 625, 0		# word 625
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 626, 0		# word 626
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 627, 0		# word 627
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 628, 0		# word 628
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 629, 0		# word 629
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 630, 0		# word 630
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 631, 0		# word 631
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 632, 0		# word 632
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 633, 0		# word 633
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 634, 0		# word 634
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 635, 0		# word 635
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 636, 0		# word 636
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 637, 0		# word 637
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 638, 0		# word 638
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 639, 0		# word 639
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 640, 0		# word 640
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 641, 0		# word 641
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 642, 0		# word 642
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 643, 0		# word 643
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 644, 0		# word 644
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 645, 0		# word 645
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 646, 0		# word 646
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 647, 0		# word 647
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 648, 0		# word 648
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 649, 0		# word 649
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 650, 0		# word 650
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 651, 0		# word 651
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 652, 0		# word 652
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 653, 0		# word 653
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 654, 0		# word 654
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 655, 0		# word 655
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 656, 0		# word 656
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 657, 0		# word 657
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 658, 0		# word 658
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 659, 0		# word 659
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 660, 0		# word 660
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 661, 0		# word 661
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 662, 0		# word 662
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 663, 0		# word 663
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 664, 0		# word 664
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 665, 0		# word 665
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 666, 0		# word 666
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 667, 0		# word 667
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 668, 0		# word 668
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 669, 0		# word 669
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 670, 0		# word 670
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 671, 0		# word 671
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 672, 0		# word 672
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 673, 0		# word 673
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 674, 0		# word 674
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 675, 0		# word 675
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 676, 0		# word 676
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 677, 0		# word 677
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 678, 0		# word 678
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 679, 0		# word 679
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 680, 0		# word 680
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 681, 0		# word 681
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 682, 0		# word 682
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 683, 0		# word 683
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 684, 0		# word 684
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 685, 0		# word 685
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 686, 0		# word 686
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 687, 0		# word 687
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 688, 0		# word 688
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 689, 0		# word 689
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 690, 0		# word 690
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 691, 0		# word 691
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 692, 0		# word 692
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 693, 0		# word 693
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 694, 0		# word 694
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 695, 0		# word 695
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 696, 0		# word 696
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 697, 0		# word 697
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 698, 0		# word 698
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 699, 0		# word 699
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 700, 0		# word 700
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 701, 0		# word 701
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 702, 0		# word 702
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 703, 0		# word 703
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 704, 0		# word 704
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 705, 0		# word 705
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 706, 0		# word 706
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 707, 0		# word 707
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 708, 0		# word 708
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 709, 0		# word 709
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 710, 0		# word 710
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 711, 0		# word 711
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 712, 0		# word 712
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 713, 0		# word 713
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 714, 0		# word 714
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 715, 0		# word 715
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 716, 0		# word 716
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 717, 0		# word 717
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 718, 0		# word 718
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 719, 0		# word 719
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 720, 0		# word 720
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 721, 0		# word 721
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 722, 0		# word 722
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 723, 0		# word 723
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 724, 0		# word 724
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 725, 0		# word 725
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 726, 0		# word 726
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 727, 0		# word 727
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 728, 0		# word 728
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 729, 0		# word 729
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 730, 0		# word 730
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 731, 0		# word 731
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 732, 0		# word 732
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 733, 0		# word 733
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 734, 0		# word 734
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 735, 0		# word 735
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 736, 0		# word 736
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 737, 0		# word 737
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 738, 0		# word 738
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 739, 0		# word 739
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 740, 0		# word 740
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 741, 0		# word 741
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 742, 0		# word 742
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 743, 0		# word 743
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 744, 0		# word 744
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 745, 0		# word 745
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 746, 0		# word 746
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 747, 0		# word 747
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 748, 0		# word 748
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 749, 0		# word 749
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 750, 0		# word 750
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 751, 0		# word 751
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 752, 0		# word 752
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 753, 0		# word 753
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 754, 0		# word 754
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 755, 0		# word 755
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 756, 0		# word 756
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 757, 0		# word 757
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 758, 0		# word 758
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 759, 0		# word 759
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 760, 0		# word 760
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 761, 0		# word 761
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 762, 0		# word 762
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 763, 0		# word 763
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 764, 0		# word 764
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 765, 0		# word 765
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 766, 0		# word 766
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 767, 0		# word 767
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 768, 0		# word 768
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 769, 0		# word 769
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 770, 0		# word 770
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 771, 0		# word 771
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 772, 0		# word 772
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 773, 0		# word 773
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 774, 0		# word 774
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 775, 0		# word 775
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 776, 0		# word 776
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 777, 0		# word 777
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 778, 0		# word 778
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 779, 0		# word 779
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 780, 0		# word 780
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 781, 0		# word 781
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 782, 0		# word 782
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 783, 0		# word 783
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 784, 0		# word 784
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 785, 0		# word 785
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 786, 0		# word 786
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 787, 0		# word 787
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 788, 0		# word 788
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 789, 0		# word 789
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 790, 0		# word 790
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 791, 0		# word 791
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 792, 0		# word 792
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 793, 0		# word 793
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 794, 0		# word 794
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 795, 0		# word 795
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 796, 0		# word 796
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 797, 0		# word 797
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 798, 0		# word 798
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 799, 0		# word 799
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 800, 0		# word 800
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 801, 0		# word 801
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 802, 0		# word 802
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 803, 0		# word 803
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 804, 0		# word 804
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 805, 0		# word 805
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 806, 0		# word 806
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 807, 0		# word 807
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 808, 0		# word 808
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 809, 0		# word 809
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 810, 0		# word 810
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 811, 0		# word 811
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 812, 0		# word 812
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 813, 0		# word 813
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 814, 0		# word 814
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 815, 0		# word 815
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 816, 0		# word 816
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 817, 0		# word 817
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 818, 0		# word 818
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 819, 0		# word 819
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 820, 0		# word 820
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 821, 0		# word 821
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 822, 0		# word 822
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 823, 0		# word 823
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 824, 0		# word 824
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 825, 0		# word 825
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 826, 0		# word 826
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 827, 0		# word 827
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 828, 0		# word 828
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 829, 0		# word 829
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 830, 0		# word 830
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 831, 0		# word 831
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 832, 0		# word 832
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 833, 0		# word 833
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 834, 0		# word 834
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 835, 0		# word 835
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 836, 0		# word 836
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 837, 0		# word 837
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 838, 0		# word 838
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 839, 0		# word 839
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 840, 0		# word 840
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 841, 0		# word 841
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 842, 0		# word 842
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 843, 0		# word 843
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 844, 0		# word 844
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 845, 0		# word 845
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 846, 0		# word 846
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 847, 0		# word 847
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 848, 0		# word 848
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 849, 0		# word 849
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 850, 0		# word 850
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 851, 0		# word 851
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 852, 0		# word 852
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 853, 0		# word 853
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 854, 0		# word 854
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 855, 0		# word 855
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 856, 0		# word 856
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 857, 0		# word 857
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 858, 0		# word 858
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 859, 0		# word 859
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 860, 0		# word 860
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 861, 0		# word 861
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 862, 0		# word 862
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 863, 0		# word 863
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 864, 0		# word 864
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 865, 0		# word 865
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 866, 0		# word 866
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 867, 0		# word 867
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 868, 0		# word 868
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 869, 0		# word 869
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 870, 0		# word 870
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 871, 0		# word 871
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 872, 0		# word 872
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 873, 0		# word 873
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 874, 0		# word 874
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 875, 0		# word 875
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 876, 0		# word 876
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 877, 0		# word 877
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 878, 0		# word 878
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 879, 0		# word 879
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 880, 0		# word 880
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 881, 0		# word 881
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 882, 0		# word 882
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 883, 0		# word 883
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 884, 0		# word 884
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 885, 0		# word 885
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 886, 0		# word 886
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 887, 0		# word 887
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 888, 0		# word 888
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 889, 0		# word 889
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 890, 0		# word 890
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 891, 0		# word 891
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 892, 0		# word 892
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 893, 0		# word 893
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 894, 0		# word 894
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 895, 0		# word 895
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 896, 0		# word 896
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 897, 0		# word 897
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 898, 0		# word 898
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 899, 0		# word 899
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 900, 0		# word 900
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 901, 0		# word 901
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 902, 0		# word 902
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 903, 0		# word 903
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 904, 0		# word 904
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 905, 0		# word 905
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 906, 0		# word 906
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 907, 0		# word 907
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 908, 0		# word 908
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 909, 0		# word 909
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 910, 0		# word 910
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 911, 0		# word 911
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 912, 0		# word 912
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 913, 0		# word 913
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 914, 0		# word 914
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 915, 0		# word 915
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 916, 0		# word 916
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 917, 0		# word 917
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 918, 0		# word 918
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 919, 0		# word 919
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 920, 0		# word 920
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 921, 0		# word 921
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 922, 0		# word 922
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 923, 0		# word 923
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 924, 0		# word 924
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 925, 0		# word 925
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 926, 0		# word 926
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 927, 0		# word 927
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 928, 0		# word 928
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 929, 0		# word 929
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 930, 0		# word 930
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 931, 0		# word 931
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 932, 0		# word 932
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 933, 0		# word 933
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 934, 0		# word 934
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 935, 0		# word 935
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 936, 0		# word 936
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 937, 0		# word 937
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 938, 0		# word 938
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 939, 0		# word 939
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 940, 0		# word 940
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 941, 0		# word 941
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 942, 0		# word 942
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 943, 0		# word 943
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 944, 0		# word 944
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 945, 0		# word 945
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 946, 0		# word 946
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 947, 0		# word 947
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 948, 0		# word 948
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 949, 0		# word 949
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 950, 0		# word 950
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 951, 0		# word 951
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 952, 0		# word 952
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 953, 0		# word 953
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 954, 0		# word 954
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 955, 0		# word 955
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 956, 0		# word 956
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 957, 0		# word 957
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 958, 0		# word 958
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 959, 0		# word 959
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 960, 0		# word 960
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 961, 0		# word 961
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 962, 0		# word 962
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 963, 0		# word 963
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 964, 0		# word 964
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 965, 0		# word 965
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 966, 0		# word 966
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 967, 0		# word 967
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 968, 0		# word 968
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 969, 0		# word 969
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 970, 0		# word 970
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 971, 0		# word 971
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 972, 0		# word 972
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 973, 0		# word 973
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 974, 0		# word 974
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 975, 0		# word 975
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 976, 0		# word 976
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 977, 0		# word 977
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 978, 0		# word 978
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 979, 0		# word 979
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 980, 0		# word 980
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 981, 0		# word 981
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 982, 0		# word 982
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 983, 0		# word 983
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 984, 0		# word 984
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 985, 0		# word 985
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 986, 0		# word 986
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 987, 0		# word 987
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 988, 0		# word 988
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 989, 0		# word 989
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 990, 0		# word 990
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 991, 0		# word 991
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 992, 0		# word 992
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 993, 0		# word 993
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 994, 0		# word 994
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 995, 0		# word 995
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 996, 0		# word 996
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 997, 0		# word 997
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 998, 0		# word 998
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 999, 0		# word 999
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1000, 0		# word 1000
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1001, 0		# word 1001
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1002, 0		# word 1002
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1003, 0		# word 1003
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1004, 0		# word 1004
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1005, 0		# word 1005
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1006, 0		# word 1006
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1007, 0		# word 1007
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1008, 0		# word 1008
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1009, 0		# word 1009
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1010, 0		# word 1010
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1011, 0		# word 1011
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1012, 0		# word 1012
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1013, 0		# word 1013
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1014, 0		# word 1014
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1015, 0		# word 1015
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1016, 0		# word 1016
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1017, 0		# word 1017
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1018, 0		# word 1018
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1019, 0		# word 1019
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1020, 0		# word 1020
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1021, 0		# word 1021
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1022, 0		# word 1022
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1023, 0		# word 1023
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1024, 0		# word 1024
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1025, 0		# word 1025
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1026, 0		# word 1026
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1027, 0		# word 1027
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1028, 0		# word 1028
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1029, 0		# word 1029
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1030, 0		# word 1030
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1031, 0		# word 1031
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1032, 0		# word 1032
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1033, 0		# word 1033
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1034, 0		# word 1034
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1035, 0		# word 1035
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1036, 0		# word 1036
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1037, 0		# word 1037
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1038, 0		# word 1038
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1039, 0		# word 1039
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1040, 0		# word 1040
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1041, 0		# word 1041
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1042, 0		# word 1042
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1043, 0		# word 1043
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1044, 0		# word 1044
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1045, 0		# word 1045
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1046, 0		# word 1046
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1047, 0		# word 1047
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1048, 0		# word 1048
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1049, 0		# word 1049
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1050, 0		# word 1050
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1051, 0		# word 1051
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1052, 0		# word 1052
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1053, 0		# word 1053
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1054, 0		# word 1054
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1055, 0		# word 1055
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1056, 0		# word 1056
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1057, 0		# word 1057
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1058, 0		# word 1058
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1059, 0		# word 1059
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1060, 0		# word 1060
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1061, 0		# word 1061
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1062, 0		# word 1062
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1063, 0		# word 1063
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1064, 0		# word 1064
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1065, 0		# word 1065
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1066, 0		# word 1066
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1067, 0		# word 1067
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1068, 0		# word 1068
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1069, 0		# word 1069
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1070, 0		# word 1070
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1071, 0		# word 1071
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1072, 0		# word 1072
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1073, 0		# word 1073
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1074, 0		# word 1074
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1075, 0		# word 1075
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1076, 0		# word 1076
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1077, 0		# word 1077
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1078, 0		# word 1078
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1079, 0		# word 1079
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1080, 0		# word 1080
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1081, 0		# word 1081
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1082, 0		# word 1082
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1083, 0		# word 1083
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1084, 0		# word 1084
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1085, 0		# word 1085
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1086, 0		# word 1086
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1087, 0		# word 1087
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1088, 0		# word 1088
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1089, 0		# word 1089
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1090, 0		# word 1090
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1091, 0		# word 1091
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1092, 0		# word 1092
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1093, 0		# word 1093
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1094, 0		# word 1094
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1095, 0		# word 1095
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1096, 0		# word 1096
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1097, 0		# word 1097
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1098, 0		# word 1098
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1099, 0		# word 1099
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1100, 0		# word 1100
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1101, 0		# word 1101
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1102, 0		# word 1102
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1103, 0		# word 1103
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1104, 0		# word 1104
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1105, 0		# word 1105
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1106, 0		# word 1106
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1107, 0		# word 1107
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1108, 0		# word 1108
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1109, 0		# word 1109
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1110, 0		# word 1110
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1111, 0		# word 1111
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1112, 0		# word 1112
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1113, 0		# word 1113
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1114, 0		# word 1114
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1115, 0		# word 1115
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1116, 0		# word 1116
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1117, 0		# word 1117
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1118, 0		# word 1118
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1119, 0		# word 1119
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1120, 0		# word 1120
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1121, 0		# word 1121
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1122, 0		# word 1122
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1123, 0		# word 1123
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1124, 0		# word 1124
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1125, 0		# word 1125
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1126, 0		# word 1126
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1127, 0		# word 1127
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1128, 0		# word 1128
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1129, 0		# word 1129
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1130, 0		# word 1130
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1131, 0		# word 1131
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1132, 0		# word 1132
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1133, 0		# word 1133
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1134, 0		# word 1134
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1135, 0		# word 1135
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1136, 0		# word 1136
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1137, 0		# word 1137
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1138, 0		# word 1138
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1139, 0		# word 1139
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1140, 0		# word 1140
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1141, 0		# word 1141
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1142, 0		# word 1142
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1143, 0		# word 1143
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1144, 0		# word 1144
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1145, 0		# word 1145
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1146, 0		# word 1146
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1147, 0		# word 1147
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1148, 0		# word 1148
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1149, 0		# word 1149
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1150, 0		# word 1150
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1151, 0		# word 1151
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1152, 0		# word 1152
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1153, 0		# word 1153
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1154, 0		# word 1154
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1155, 0		# word 1155
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1156, 0		# word 1156
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1157, 0		# word 1157
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1158, 0		# word 1158
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1159, 0		# word 1159
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1160, 0		# word 1160
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1161, 0		# word 1161
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1162, 0		# word 1162
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1163, 0		# word 1163
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1164, 0		# word 1164
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1165, 0		# word 1165
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1166, 0		# word 1166
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1167, 0		# word 1167
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1168, 0		# word 1168
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1169, 0		# word 1169
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1170, 0		# word 1170
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1171, 0		# word 1171
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1172, 0		# word 1172
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1173, 0		# word 1173
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1174, 0		# word 1174
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1175, 0		# word 1175
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1176, 0		# word 1176
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1177, 0		# word 1177
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1178, 0		# word 1178
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1179, 0		# word 1179
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1180, 0		# word 1180
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1181, 0		# word 1181
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1182, 0		# word 1182
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1183, 0		# word 1183
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1184, 0		# word 1184
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1185, 0		# word 1185
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1186, 0		# word 1186
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1187, 0		# word 1187
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1188, 0		# word 1188
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1189, 0		# word 1189
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1190, 0		# word 1190
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1191, 0		# word 1191
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1192, 0		# word 1192
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1193, 0		# word 1193
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1194, 0		# word 1194
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1195, 0		# word 1195
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1196, 0		# word 1196
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1197, 0		# word 1197
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1198, 0		# word 1198
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1199, 0		# word 1199
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1200, 0		# word 1200
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1201, 0		# word 1201
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1202, 0		# word 1202
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1203, 0		# word 1203
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1204, 0		# word 1204
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1205, 0		# word 1205
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1206, 0		# word 1206
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1207, 0		# word 1207
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1208, 0		# word 1208
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1209, 0		# word 1209
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1210, 0		# word 1210
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1211, 0		# word 1211
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1212, 0		# word 1212
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1213, 0		# word 1213
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1214, 0		# word 1214
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1215, 0		# word 1215
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1216, 0		# word 1216
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1217, 0		# word 1217
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1218, 0		# word 1218
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1219, 0		# word 1219
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1220, 0		# word 1220
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1221, 0		# word 1221
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1222, 0		# word 1222
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1223, 0		# word 1223
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1224, 0		# word 1224
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1225, 0		# word 1225
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1226, 0		# word 1226
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1227, 0		# word 1227
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1228, 0		# word 1228
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1229, 0		# word 1229
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1230, 0		# word 1230
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1231, 0		# word 1231
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1232, 0		# word 1232
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1233, 0		# word 1233
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1234, 0		# word 1234
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1235, 0		# word 1235
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1236, 0		# word 1236
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1237, 0		# word 1237
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1238, 0		# word 1238
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1239, 0		# word 1239
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1240, 0		# word 1240
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1241, 0		# word 1241
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1242, 0		# word 1242
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1243, 0		# word 1243
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1244, 0		# word 1244
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1245, 0		# word 1245
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1246, 0		# word 1246
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1247, 0		# word 1247
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1248, 0		# word 1248
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1249, 0		# word 1249
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1250, 0		# word 1250
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1251, 0		# word 1251
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1252, 0		# word 1252
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1253, 0		# word 1253
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1254, 0		# word 1254
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1255, 0		# word 1255
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1256, 0		# word 1256
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1257, 0		# word 1257
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1258, 0		# word 1258
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1259, 0		# word 1259
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1260, 0		# word 1260
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1261, 0		# word 1261
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1262, 0		# word 1262
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1263, 0		# word 1263
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1264, 0		# word 1264
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1265, 0		# word 1265
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1266, 0		# word 1266
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1267, 0		# word 1267
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1268, 0		# word 1268
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1269, 0		# word 1269
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1270, 0		# word 1270
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1271, 0		# word 1271
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1272, 0		# word 1272
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1273, 0		# word 1273
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1274, 0		# word 1274
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1275, 0		# word 1275
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1276, 0		# word 1276
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1277, 0		# word 1277
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1278, 0		# word 1278
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1279, 0		# word 1279
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1280, 0		# word 1280
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1281, 0		# word 1281
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1282, 0		# word 1282
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1283, 0		# word 1283
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1284, 0		# word 1284
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1285, 0		# word 1285
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1286, 0		# word 1286
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1287, 0		# word 1287
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1288, 0		# word 1288
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1289, 0		# word 1289
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1290, 0		# word 1290
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1291, 0		# word 1291
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1292, 0		# word 1292
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1293, 0		# word 1293
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1294, 0		# word 1294
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1295, 0		# word 1295
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1296, 0		# word 1296
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1297, 0		# word 1297
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1298, 0		# word 1298
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1299, 0		# word 1299
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1300, 0		# word 1300
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1301, 0		# word 1301
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1302, 0		# word 1302
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1303, 0		# word 1303
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1304, 0		# word 1304
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1305, 0		# word 1305
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1306, 0		# word 1306
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1307, 0		# word 1307
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1308, 0		# word 1308
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1309, 0		# word 1309
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1310, 0		# word 1310
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1311, 0		# word 1311
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1312, 0		# word 1312
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1313, 0		# word 1313
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1314, 0		# word 1314
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1315, 0		# word 1315
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1316, 0		# word 1316
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1317, 0		# word 1317
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1318, 0		# word 1318
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1319, 0		# word 1319
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1320, 0		# word 1320
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1321, 0		# word 1321
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1322, 0		# word 1322
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1323, 0		# word 1323
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1324, 0		# word 1324
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1325, 0		# word 1325
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1326, 0		# word 1326
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1327, 0		# word 1327
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1328, 0		# word 1328
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1329, 0		# word 1329
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1330, 0		# word 1330
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1331, 0		# word 1331
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1332, 0		# word 1332
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1333, 0		# word 1333
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1334, 0		# word 1334
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1335, 0		# word 1335
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1336, 0		# word 1336
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1337, 0		# word 1337
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1338, 0		# word 1338
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1339, 0		# word 1339
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1340, 0		# word 1340
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1341, 0		# word 1341
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1342, 0		# word 1342
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1343, 0		# word 1343
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1344, 0		# word 1344
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1345, 0		# word 1345
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1346, 0		# word 1346
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1347, 0		# word 1347
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1348, 0		# word 1348
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1349, 0		# word 1349
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1350, 0		# word 1350
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1351, 0		# word 1351
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1352, 0		# word 1352
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1353, 0		# word 1353
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1354, 0		# word 1354
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1355, 0		# word 1355
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1356, 0		# word 1356
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1357, 0		# word 1357
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1358, 0		# word 1358
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1359, 0		# word 1359
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1360, 0		# word 1360
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1361, 0		# word 1361
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1362, 0		# word 1362
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1363, 0		# word 1363
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1364, 0		# word 1364
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1365, 0		# word 1365
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1366, 0		# word 1366
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1367, 0		# word 1367
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1368, 0		# word 1368
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1369, 0		# word 1369
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1370, 0		# word 1370
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1371, 0		# word 1371
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1372, 0		# word 1372
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1373, 0		# word 1373
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1374, 0		# word 1374
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1375, 0		# word 1375
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1376, 0		# word 1376
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1377, 0		# word 1377
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1378, 0		# word 1378
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1379, 0		# word 1379
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1380, 0		# word 1380
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1381, 0		# word 1381
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1382, 0		# word 1382
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1383, 0		# word 1383
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1384, 0		# word 1384
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1385, 0		# word 1385
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1386, 0		# word 1386
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1387, 0		# word 1387
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1388, 0		# word 1388
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1389, 0		# word 1389
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1390, 0		# word 1390
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1391, 0		# word 1391
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1392, 0		# word 1392
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1393, 0		# word 1393
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1394, 0		# word 1394
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1395, 0		# word 1395
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1396, 0		# word 1396
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1397, 0		# word 1397
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1398, 0		# word 1398
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1399, 0		# word 1399
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1400, 0		# word 1400
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1401, 0		# word 1401
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1402, 0		# word 1402
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1403, 0		# word 1403
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1404, 0		# word 1404
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1405, 0		# word 1405
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1406, 0		# word 1406
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1407, 0		# word 1407
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1408, 0		# word 1408
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1409, 0		# word 1409
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1410, 0		# word 1410
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1411, 0		# word 1411
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1412, 0		# word 1412
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1413, 0		# word 1413
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1414, 0		# word 1414
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1415, 0		# word 1415
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1416, 0		# word 1416
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1417, 0		# word 1417
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1418, 0		# word 1418
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1419, 0		# word 1419
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1420, 0		# word 1420
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1421, 0		# word 1421
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1422, 0		# word 1422
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1423, 0		# word 1423
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1424, 0		# word 1424
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1425, 0		# word 1425
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1426, 0		# word 1426
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1427, 0		# word 1427
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1428, 0		# word 1428
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1429, 0		# word 1429
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1430, 0		# word 1430
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1431, 0		# word 1431
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1432, 0		# word 1432
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1433, 0		# word 1433
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1434, 0		# word 1434
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1435, 0		# word 1435
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1436, 0		# word 1436
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1437, 0		# word 1437
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1438, 0		# word 1438
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1439, 0		# word 1439
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1440, 0		# word 1440
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1441, 0		# word 1441
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1442, 0		# word 1442
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1443, 0		# word 1443
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1444, 0		# word 1444
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1445, 0		# word 1445
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1446, 0		# word 1446
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1447, 0		# word 1447
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1448, 0		# word 1448
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1449, 0		# word 1449
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1450, 0		# word 1450
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1451, 0		# word 1451
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1452, 0		# word 1452
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1453, 0		# word 1453
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1454, 0		# word 1454
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1455, 0		# word 1455
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1456, 0		# word 1456
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1457, 0		# word 1457
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1458, 0		# word 1458
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1459, 0		# word 1459
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1460, 0		# word 1460
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1461, 0		# word 1461
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1462, 0		# word 1462
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1463, 0		# word 1463
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1464, 0		# word 1464
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1465, 0		# word 1465
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1466, 0		# word 1466
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1467, 0		# word 1467
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1468, 0		# word 1468
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1469, 0		# word 1469
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1470, 0		# word 1470
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1471, 0		# word 1471
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1472, 0		# word 1472
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1473, 0		# word 1473
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1474, 0		# word 1474
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1475, 0		# word 1475
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1476, 0		# word 1476
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1477, 0		# word 1477
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1478, 0		# word 1478
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1479, 0		# word 1479
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1480, 0		# word 1480
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1481, 0		# word 1481
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1482, 0		# word 1482
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1483, 0		# word 1483
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1484, 0		# word 1484
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1485, 0		# word 1485
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1486, 0		# word 1486
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1487, 0		# word 1487
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1488, 0		# word 1488
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1489, 0		# word 1489
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1490, 0		# word 1490
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1491, 0		# word 1491
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1492, 0		# word 1492
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1493, 0		# word 1493
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1494, 0		# word 1494
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1495, 0		# word 1495
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1496, 0		# word 1496
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1497, 0		# word 1497
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1498, 0		# word 1498
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1499, 0		# word 1499
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1500, 0		# word 1500
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1501, 0		# word 1501
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1502, 0		# word 1502
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1503, 0		# word 1503
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1504, 0		# word 1504
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1505, 0		# word 1505
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1506, 0		# word 1506
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1507, 0		# word 1507
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1508, 0		# word 1508
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1509, 0		# word 1509
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1510, 0		# word 1510
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1511, 0		# word 1511
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1512, 0		# word 1512
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1513, 0		# word 1513
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1514, 0		# word 1514
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1515, 0		# word 1515
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1516, 0		# word 1516
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1517, 0		# word 1517
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1518, 0		# word 1518
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1519, 0		# word 1519
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1520, 0		# word 1520
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1521, 0		# word 1521
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1522, 0		# word 1522
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1523, 0		# word 1523
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1524, 0		# word 1524
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1525, 0		# word 1525
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1526, 0		# word 1526
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1527, 0		# word 1527
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1528, 0		# word 1528
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1529, 0		# word 1529
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1530, 0		# word 1530
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1531, 0		# word 1531
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1532, 0		# word 1532
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1533, 0		# word 1533
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1534, 0		# word 1534
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1535, 0		# word 1535
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1536, 0		# word 1536
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1537, 0		# word 1537
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1538, 0		# word 1538
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1539, 0		# word 1539
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1540, 0		# word 1540
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1541, 0		# word 1541
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1542, 0		# word 1542
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1543, 0		# word 1543
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1544, 0		# word 1544
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1545, 0		# word 1545
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1546, 0		# word 1546
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1547, 0		# word 1547
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1548, 0		# word 1548
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1549, 0		# word 1549
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1550, 0		# word 1550
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1551, 0		# word 1551
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1552, 0		# word 1552
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1553, 0		# word 1553
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1554, 0		# word 1554
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1555, 0		# word 1555
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1556, 0		# word 1556
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1557, 0		# word 1557
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1558, 0		# word 1558
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1559, 0		# word 1559
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1560, 0		# word 1560
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1561, 0		# word 1561
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1562, 0		# word 1562
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1563, 0		# word 1563
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1564, 0		# word 1564
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1565, 0		# word 1565
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1566, 0		# word 1566
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1567, 0		# word 1567
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1568, 0		# word 1568
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1569, 0		# word 1569
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1570, 0		# word 1570
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1571, 0		# word 1571
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1572, 0		# word 1572
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1573, 0		# word 1573
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1574, 0		# word 1574
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1575, 0		# word 1575
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1576, 0		# word 1576
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1577, 0		# word 1577
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1578, 0		# word 1578
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1579, 0		# word 1579
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1580, 0		# word 1580
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1581, 0		# word 1581
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1582, 0		# word 1582
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1583, 0		# word 1583
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1584, 0		# word 1584
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1585, 0		# word 1585
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1586, 0		# word 1586
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1587, 0		# word 1587
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1588, 0		# word 1588
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1589, 0		# word 1589
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1590, 0		# word 1590
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1591, 0		# word 1591
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1592, 0		# word 1592
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1593, 0		# word 1593
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1594, 0		# word 1594
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1595, 0		# word 1595
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1596, 0		# word 1596
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1597, 0		# word 1597
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1598, 0		# word 1598
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1599, 0		# word 1599
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1600, 0		# word 1600
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1601, 0		# word 1601
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1602, 0		# word 1602
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1603, 0		# word 1603
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1604, 0		# word 1604
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1605, 0		# word 1605
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1606, 0		# word 1606
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1607, 0		# word 1607
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1608, 0		# word 1608
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1609, 0		# word 1609
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1610, 0		# word 1610
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1611, 0		# word 1611
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1612, 0		# word 1612
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1613, 0		# word 1613
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1614, 0		# word 1614
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1615, 0		# word 1615
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1616, 0		# word 1616
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1617, 0		# word 1617
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1618, 0		# word 1618
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1619, 0		# word 1619
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1620, 0		# word 1620
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1621, 0		# word 1621
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1622, 0		# word 1622
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1623, 0		# word 1623
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1624, 0		# word 1624
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1625, 0		# word 1625
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1626, 0		# word 1626
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1627, 0		# word 1627
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1628, 0		# word 1628
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1629, 0		# word 1629
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1630, 0		# word 1630
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1631, 0		# word 1631
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1632, 0		# word 1632
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1633, 0		# word 1633
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1634, 0		# word 1634
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1635, 0		# word 1635
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1636, 0		# word 1636
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1637, 0		# word 1637
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1638, 0		# word 1638
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1639, 0		# word 1639
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1640, 0		# word 1640
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1641, 0		# word 1641
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1642, 0		# word 1642
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1643, 0		# word 1643
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1644, 0		# word 1644
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1645, 0		# word 1645
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1646, 0		# word 1646
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1647, 0		# word 1647
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1648, 0		# word 1648
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1649, 0		# word 1649
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1650, 0		# word 1650
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1651, 0		# word 1651
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1652, 0		# word 1652
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1653, 0		# word 1653
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1654, 0		# word 1654
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1655, 0		# word 1655
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1656, 0		# word 1656
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1657, 0		# word 1657
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1658, 0		# word 1658
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1659, 0		# word 1659
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1660, 0		# word 1660
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1661, 0		# word 1661
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1662, 0		# word 1662
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1663, 0		# word 1663
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1664, 0		# word 1664
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1665, 0		# word 1665
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1666, 0		# word 1666
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1667, 0		# word 1667
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1668, 0		# word 1668
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1669, 0		# word 1669
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1670, 0		# word 1670
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1671, 0		# word 1671
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1672, 0		# word 1672
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1673, 0		# word 1673
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1674, 0		# word 1674
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1675, 0		# word 1675
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1676, 0		# word 1676
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1677, 0		# word 1677
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1678, 0		# word 1678
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1679, 0		# word 1679
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1680, 0		# word 1680
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1681, 0		# word 1681
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1682, 0		# word 1682
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1683, 0		# word 1683
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1684, 0		# word 1684
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1685, 0		# word 1685
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1686, 0		# word 1686
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1687, 0		# word 1687
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1688, 0		# word 1688
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1689, 0		# word 1689
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1690, 0		# word 1690
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1691, 0		# word 1691
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1692, 0		# word 1692
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1693, 0		# word 1693
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1694, 0		# word 1694
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1695, 0		# word 1695
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1696, 0		# word 1696
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1697, 0		# word 1697
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1698, 0		# word 1698
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1699, 0		# word 1699
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1700, 0		# word 1700
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1701, 0		# word 1701
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1702, 0		# word 1702
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1703, 0		# word 1703
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1704, 0		# word 1704
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1705, 0		# word 1705
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1706, 0		# word 1706
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1707, 0		# word 1707
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1708, 0		# word 1708
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1709, 0		# word 1709
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1710, 0		# word 1710
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1711, 0		# word 1711
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1712, 0		# word 1712
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1713, 0		# word 1713
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1714, 0		# word 1714
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1715, 0		# word 1715
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1716, 0		# word 1716
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1717, 0		# word 1717
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1718, 0		# word 1718
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1719, 0		# word 1719
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1720, 0		# word 1720
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1721, 0		# word 1721
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1722, 0		# word 1722
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1723, 0		# word 1723
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1724, 0		# word 1724
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1725, 0		# word 1725
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1726, 0		# word 1726
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1727, 0		# word 1727
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1728, 0		# word 1728
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1729, 0		# word 1729
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1730, 0		# word 1730
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1731, 0		# word 1731
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1732, 0		# word 1732
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1733, 0		# word 1733
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1734, 0		# word 1734
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1735, 0		# word 1735
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1736, 0		# word 1736
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1737, 0		# word 1737
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1738, 0		# word 1738
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1739, 0		# word 1739
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1740, 0		# word 1740
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1741, 0		# word 1741
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1742, 0		# word 1742
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1743, 0		# word 1743
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1744, 0		# word 1744
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1745, 0		# word 1745
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1746, 0		# word 1746
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1747, 0		# word 1747
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1748, 0		# word 1748
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1749, 0		# word 1749
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1750, 0		# word 1750
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1751, 0		# word 1751
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1752, 0		# word 1752
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1753, 0		# word 1753
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1754, 0		# word 1754
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1755, 0		# word 1755
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1756, 0		# word 1756
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1757, 0		# word 1757
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1758, 0		# word 1758
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1759, 0		# word 1759
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1760, 0		# word 1760
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1761, 0		# word 1761
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1762, 0		# word 1762
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1763, 0		# word 1763
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1764, 0		# word 1764
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1765, 0		# word 1765
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1766, 0		# word 1766
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1767, 0		# word 1767
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1768, 0		# word 1768
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1769, 0		# word 1769
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1770, 0		# word 1770
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1771, 0		# word 1771
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1772, 0		# word 1772
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1773, 0		# word 1773
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1774, 0		# word 1774
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1775, 0		# word 1775
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1776, 0		# word 1776
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1777, 0		# word 1777
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1778, 0		# word 1778
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1779, 0		# word 1779
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1780, 0		# word 1780
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1781, 0		# word 1781
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1782, 0		# word 1782
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1783, 0		# word 1783
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1784, 0		# word 1784
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1785, 0		# word 1785
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1786, 0		# word 1786
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1787, 0		# word 1787
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1788, 0		# word 1788
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1789, 0		# word 1789
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1790, 0		# word 1790
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1791, 0		# word 1791
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1792, 0		# word 1792
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1793, 0		# word 1793
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1794, 0		# word 1794
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1795, 0		# word 1795
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1796, 0		# word 1796
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1797, 0		# word 1797
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1798, 0		# word 1798
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1799, 0		# word 1799
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1800, 0		# word 1800
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1801, 0		# word 1801
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1802, 0		# word 1802
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1803, 0		# word 1803
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1804, 0		# word 1804
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1805, 0		# word 1805
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1806, 0		# word 1806
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1807, 0		# word 1807
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1808, 0		# word 1808
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1809, 0		# word 1809
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1810, 0		# word 1810
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1811, 0		# word 1811
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1812, 0		# word 1812
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1813, 0		# word 1813
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1814, 0		# word 1814
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1815, 0		# word 1815
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1816, 0		# word 1816
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1817, 0		# word 1817
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1818, 0		# word 1818
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1819, 0		# word 1819
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1820, 0		# word 1820
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1821, 0		# word 1821
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1822, 0		# word 1822
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1823, 0		# word 1823
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1824, 0		# word 1824
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1825, 0		# word 1825
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1826, 0		# word 1826
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1827, 0		# word 1827
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1828, 0		# word 1828
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1829, 0		# word 1829
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1830, 0		# word 1830
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1831, 0		# word 1831
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1832, 0		# word 1832
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1833, 0		# word 1833
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1834, 0		# word 1834
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1835, 0		# word 1835
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1836, 0		# word 1836
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1837, 0		# word 1837
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1838, 0		# word 1838
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1839, 0		# word 1839
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1840, 0		# word 1840
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1841, 0		# word 1841
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1842, 0		# word 1842
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1843, 0		# word 1843
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1844, 0		# word 1844
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1845, 0		# word 1845
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1846, 0		# word 1846
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1847, 0		# word 1847
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1848, 0		# word 1848
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1849, 0		# word 1849
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1850, 0		# word 1850
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1851, 0		# word 1851
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1852, 0		# word 1852
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1853, 0		# word 1853
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1854, 0		# word 1854
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1855, 0		# word 1855
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1856, 0		# word 1856
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1857, 0		# word 1857
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1858, 0		# word 1858
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1859, 0		# word 1859
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1860, 0		# word 1860
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1861, 0		# word 1861
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1862, 0		# word 1862
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1863, 0		# word 1863
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1864, 0		# word 1864
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1865, 0		# word 1865
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1866, 0		# word 1866
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1867, 0		# word 1867
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1868, 0		# word 1868
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1869, 0		# word 1869
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1870, 0		# word 1870
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1871, 0		# word 1871
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1872, 0		# word 1872
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1873, 0		# word 1873
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1874, 0		# word 1874
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1875, 0		# word 1875
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1876, 0		# word 1876
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1877, 0		# word 1877
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1878, 0		# word 1878
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1879, 0		# word 1879
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1880, 0		# word 1880
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1881, 0		# word 1881
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1882, 0		# word 1882
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1883, 0		# word 1883
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1884, 0		# word 1884
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1885, 0		# word 1885
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1886, 0		# word 1886
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1887, 0		# word 1887
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1888, 0		# word 1888
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1889, 0		# word 1889
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1890, 0		# word 1890
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1891, 0		# word 1891
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1892, 0		# word 1892
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1893, 0		# word 1893
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1894, 0		# word 1894
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1895, 0		# word 1895
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1896, 0		# word 1896
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1897, 0		# word 1897
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1898, 0		# word 1898
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1899, 0		# word 1899
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1900, 0		# word 1900
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1901, 0		# word 1901
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1902, 0		# word 1902
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1903, 0		# word 1903
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1904, 0		# word 1904
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1905, 0		# word 1905
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1906, 0		# word 1906
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1907, 0		# word 1907
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1908, 0		# word 1908
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1909, 0		# word 1909
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1910, 0		# word 1910
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1911, 0		# word 1911
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1912, 0		# word 1912
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1913, 0		# word 1913
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1914, 0		# word 1914
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1915, 0		# word 1915
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1916, 0		# word 1916
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1917, 0		# word 1917
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1918, 0		# word 1918
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1919, 0		# word 1919
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1920, 0		# word 1920
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1921, 0		# word 1921
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1922, 0		# word 1922
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1923, 0		# word 1923
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1924, 0		# word 1924
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1925, 0		# word 1925
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1926, 0		# word 1926
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1927, 0		# word 1927
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1928, 0		# word 1928
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1929, 0		# word 1929
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1930, 0		# word 1930
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1931, 0		# word 1931
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1932, 0		# word 1932
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1933, 0		# word 1933
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1934, 0		# word 1934
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1935, 0		# word 1935
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1936, 0		# word 1936
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1937, 0		# word 1937
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1938, 0		# word 1938
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1939, 0		# word 1939
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1940, 0		# word 1940
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1941, 0		# word 1941
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1942, 0		# word 1942
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1943, 0		# word 1943
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1944, 0		# word 1944
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1945, 0		# word 1945
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1946, 0		# word 1946
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1947, 0		# word 1947
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1948, 0		# word 1948
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1949, 0		# word 1949
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1950, 0		# word 1950
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1951, 0		# word 1951
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1952, 0		# word 1952
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1953, 0		# word 1953
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1954, 0		# word 1954
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1955, 0		# word 1955
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1956, 0		# word 1956
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1957, 0		# word 1957
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1958, 0		# word 1958
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1959, 0		# word 1959
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1960, 0		# word 1960
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1961, 0		# word 1961
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1962, 0		# word 1962
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1963, 0		# word 1963
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1964, 0		# word 1964
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1965, 0		# word 1965
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1966, 0		# word 1966
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1967, 0		# word 1967
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1968, 0		# word 1968
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1969, 0		# word 1969
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1970, 0		# word 1970
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1971, 0		# word 1971
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1972, 0		# word 1972
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1973, 0		# word 1973
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1974, 0		# word 1974
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1975, 0		# word 1975
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1976, 0		# word 1976
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1977, 0		# word 1977
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1978, 0		# word 1978
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1979, 0		# word 1979
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1980, 0		# word 1980
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1981, 0		# word 1981
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1982, 0		# word 1982
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1983, 0		# word 1983
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1984, 0		# word 1984
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1985, 0		# word 1985
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1986, 0		# word 1986
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1987, 0		# word 1987
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1988, 0		# word 1988
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1989, 0		# word 1989
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1990, 0		# word 1990
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1991, 0		# word 1991
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1992, 0		# word 1992
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1993, 0		# word 1993
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1994, 0		# word 1994
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1995, 0		# word 1995
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1996, 0		# word 1996
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1997, 0		# word 1997
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1998, 0		# word 1998
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 1999, 0		# word 1999
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 2000, 0		# word 2000
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 2001, 0		# word 2001
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 2002, 0		# word 2002
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 2003, 0		# word 2003
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 2004, 0		# word 2004
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 2005, 0		# word 2005
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 2006, 0		# word 2006
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 2007, 0		# word 2007
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 2008, 0		# word 2008
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 2009, 0		# word 2009
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 2010, 0		# word 2010
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 2011, 0		# word 2011
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 2012, 0		# word 2012
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 2013, 0		# word 2013
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 2014, 0		# word 2014
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 2015, 0		# word 2015
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 2016, 0		# word 2016
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 2017, 0		# word 2017
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 2018, 0		# word 2018
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 2019, 0		# word 2019
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 2020, 0		# word 2020
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 2021, 0		# word 2021
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 2022, 0		# word 2022
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 2023, 0		# word 2023
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 2024, 0		# word 2024
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 2025, 0		# word 2025
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 2026, 0		# word 2026
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 2027, 0		# word 2027
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 2028, 0		# word 2028
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 2029, 0		# word 2029
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 2030, 0		# word 2030
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 2031, 0		# word 2031
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 2032, 0		# word 2032
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 2033, 0		# word 2033
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 2034, 0		# word 2034
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 2035, 0		# word 2035
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 2036, 0		# word 2036
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 2037, 0		# word 2037
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 2038, 0		# word 2038
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	lw $t1, $zero, $imm1, $zero, 2039, 0		# word 2039
+	mac $t0, $t0, $imm1, $t1, 31, 0		# h = h * 31 - word
+	sw $zero, $imm1, $zero, $t0, 2047, 0		# dmem[2047] = h
+	halt $zero, $zero, $zero, $zero, 0, 0		# halt
+.word 0 32758
+.word 1 40951
+.word 2 36452
+.word 3 18637
+.word 4 42370
+.word 5 17555
+.word 6 11472
+.word 7 42185
+.word 8 38862
+.word 9 38639
+.word 10 17916
+.word 11 50309
+.word 12 25306
+.word 13 45835
+.word 14 50664
+.word 15 9217
+.word 16 53926
+.word 17 29927
+.word 18 22676
+.word 19 65341
+.word 20 29490
+.word 21 30851
+.word 22 27136
+.word 23 21049
+.word 24 36990
+.word 25 6623
+.word 26 9772
+.word 27 55541
+.word 28 13962
+.word 29 29947
+.word 30 31000
+.word 31 3953
+.word 32 12630
+.word 33 26071
+.word 34 3780
+.word 35 12717
+.word 36 3298
+.word 37 34931
+.word 38 21296
+.word 39 15273
+.word 40 5422
+.word 41 14543
+.word 42 29276
+.word 43 59749
+.word 44 22074
+.word 45 37611
+.word 46 22600
+.word 47 46817
+.word 48 39942
+.word 49 29383
+.word 50 45300
+.word 51 57373
+.word 52 29330
+.word 53 29795
+.word 54 59488
+.word 55 24857
+.word 56 9694
+.word 57 62399
+.word 58 10892
+.word 59 62933
+.word 60 49642
+.word 61 3291
+.word 62 25464
+.word 63 6737
+.word 64 4790
+.word 65 39863
+.word 66 16164
+.word 67 2701
+.word 68 42050
+.word 69 15443
+.word 70 10640
+.word 71 49801
+.word 72 49806
+.word 73 19119
+.word 74 20156
+.word 75 65093
+.word 76 31130
+.word 77 58059
+.word 78 39592
+.word 79 14785
+.word 80 38246
+.word 81 57511
+.word 82 47444
+.word 83 45309
+.word 84 41458
+.word 85 57411
+.word 86 5824
+.word 87 24569
+.word 88 60222
+.word 89 15775
+.word 90 57068
+.word 91 693
+.word 92 32074
+.word 93 5307
+.word 94 64984
+.word 95 5425
+.word 96 9238
+.word 97 16791
+.word 98 8068
+.word 99 54125
+.word 100 27554
+.word 101 24627
+.word 102 45040
+.word 103 14697
+.word 104 40942
+.word 105 52367
+.word 106 56092
+.word 107 805
+.word 108 52474
+.word 109 41643
+.word 110 36104
+.word 111 44193
+.word 112 48838
+.word 113 48775
+.word 114 29108
+.word 115 29149
+.word 116 338
+.word 117 48163
+.word 118 62752
+.word 119 20185
+.word 120 57502
+.word 121 63359
+.word 122 17228
+.word 123 65429
+.word 124 26794
+.word 125 35995
+.word 126 18488
+.word 127 17
+.word 128 25974
+.word 129 22391
+.word 130 45028
+.word 131 35917
+.word 132 25346
+.word 133 62483
+.word 134 58960
+.word 135 41033
+.word 136 44366
+.word 137 48751
+.word 138 6012
+.word 139 63493
+.word 140 20570
+.word 141 53899
+.word 142 12136
+.word 143 3969
+.word 144 6182
+.word 145 3175
+.word 146 55828
+.word 147 8893
+.word 148 37042
+.word 149 2051
+.word 150 33664
+.word 151 11705
+.word 152 1534
+.word 153 8543
+.word 154 22444
+.word 155 60533
+.word 156 33802
+.word 157 29819
+.word 158 17048
+.word 159 56049
+.word 160 54998
+.word 161 56663
+.word 162 61508
+.word 163 13613
+.word 164 35426
+.word 165 63475
+.word 166 52400
+.word 167 63273
+.word 168 60078
+.word 169 8271
+.word 170 988
+.word 171 56549
+.word 172 954
+.word 173 29291
+.word 174 33224
+.word 175 25185
+.word 176 41350
+.word 177 51783
+.word 178 62068
+.word 179 50077
+.word 180 20498
+.word 181 50147
+.word 182 49632
+.word 183 64665
+.word 184 23390
+.word 185 47935
+.word 186 7180
+.word 187 51541
+.word 188 53098
+.word 189 52315
+.word 190 60664
+.word 191 42449
+.word 192 30774
+.word 193 54071
+.word 194 57508
+.word 195 52749
+.word 196 57794
+.word 197 27603
+.word 198 25360
+.word 199 15881
+.word 200 22542
+.word 201 61999
+.word 202 41020
+.word 203 45509
+.word 204 59162
+.word 205 33355
+.word 206 33832
+.word 207 42305
+.word 208 23270
+.word 209 63527
+.word 210 47828
+.word 211 21629
+.word 212 16242
+.word 213 61379
+.word 214 45120
+.word 215 47993
+.word 216 57534
+.word 217 50463
+.word 218 36972
+.word 219 38453
+.word 220 19146
+.word 221 37947
+.word 222 18264
+.word 223 24753
+.word 224 18838
+.word 225 14615
+.word 226 33028
+.word 227 22253
+.word 228 26914
+.word 229 20403
+.word 230 43376
+.word 231 29929
+.word 232 62830
+.word 233 13327
+.word 234 60572
+.word 235 30373
+.word 236 64122
+.word 237 555
+.word 238 13960
+.word 239 55329
+.word 240 17478
+.word 241 38407
+.word 242 13108
+.word 243 54621
+.word 244 24274
+.word 245 35747
+.word 246 20128
+.word 247 27225
+.word 248 38430
+.word 249 16127
+.word 250 46284
+.word 251 21269
+.word 252 63018
+.word 253 52251
+.word 254 20920
+.word 255 2961
+.word 256 19190
+.word 257 3831
+.word 258 53604
+.word 259 53197
+.word 260 8322
+.word 261 41875
+.word 262 40912
+.word 263 39881
+.word 264 49870
+.word 265 58863
+.word 266 59644
+.word 267 11141
+.word 268 15834
+.word 269 61963
+.word 270 39144
+.word 271 64257
+.word 272 23974
+.word 273 41959
+.word 274 23444
+.word 275 17981
+.word 276 44594
+.word 277 38787
+.word 278 40192
+.word 279 2361
+.word 280 31614
+.word 281 10463
+.word 282 35116
+.word 283 65525
+.word 284 53642
+.word 285 29691
+.word 286 3096
+.word 287 42609
+.word 288 31830
+.word 289 21719
+.word 290 53700
+.word 291 14509
+.word 292 2018
+.word 293 26483
+.word 294 17968
+.word 295 45737
+.word 296 49198
+.word 297 1999
+.word 298 38236
+.word 299 53349
+.word 300 45370
+.word 301 20971
+.word 302 43848
+.word 303 3553
+.word 304 42758
+.word 305 8647
+.word 306 13300
+.word 307 42781
+.word 308 11666
+.word 309 4963
+.word 310 39776
+.word 311 38937
+.word 312 37086
+.word 313 33471
+.word 314 3468
+.word 315 40149
+.word 316 56554
+.word 317 35803
+.word 318 30328
+.word 319 12625
+.word 320 56758
+.word 321 2743
+.word 322 33316
+.word 323 37261
+.word 324 8002
+.word 325 39763
+.word 326 40080
+.word 327 47497
+.word 328 60814
+.word 329 39343
+.word 330 61884
+.word 331 25925
+.word 332 21658
+.word 333 8651
+.word 334 28072
+.word 335 4289
+.word 336 8294
+.word 337 4007
+.word 338 48212
+.word 339 63485
+.word 340 56562
+.word 341 65347
+.word 342 18880
+.word 343 5881
+.word 344 54846
+.word 345 19615
+.word 346 16876
+.word 347 10677
+.word 348 6218
+.word 349 5051
+.word 350 37080
+.word 351 44081
+.word 352 28438
+.word 353 12439
+.word 354 57988
+.word 355 55917
+.word 356 26274
+.word 357 16179
+.word 358 41712
+.word 359 45161
+.word 360 19182
+.word 361 39823
+.word 362 65052
+.word 363 59941
+.word 364 10234
+.word 365 25003
+.word 366 57352
+.word 367 929
+.word 368 51654
+.word 369 28039
+.word 370 62644
+.word 371 14557
+.word 372 48210
+.word 373 23331
+.word 374 43040
+.word 375 34265
+.word 376 19358
+.word 377 34431
+.word 378 9804
+.word 379 42645
+.word 380 33706
+.word 381 2971
+.word 382 23352
+.word 383 5905
+.word 384 12406
+.word 385 50807
+.word 386 62180
+.word 387 4941
+.word 388 56834
+.word 389 21267
+.word 390 22864
+.word 391 38729
+.word 392 55374
+.word 393 3439
+.word 394 47740
+.word 395 24325
+.word 396 11098
+.word 397 4491
+.word 398 616
+.word 399 59009
+.word 400 41766
+.word 401 15207
+.word 402 56596
+.word 403 27069
+.word 404 52146
+.word 405 9987
+.word 406 46720
+.word 407 58553
+.word 408 61694
+.word 409 12383
+.word 410 47788
+.word 411 4981
+.word 412 7946
+.word 413 29563
+.word 414 54680
+.word 415 29169
+.word 416 8662
+.word 417 52311
+.word 418 45892
+.word 419 15405
+.word 420 34146
+.word 421 55027
+.word 422 49072
+.word 423 28201
+.word 424 38318
+.word 425 61263
+.word 426 9948
+.word 427 50149
+.word 428 24250
+.word 429 12651
+.word 430 54472
+.word 431 47457
+.word 432 44166
+.word 433 31047
+.word 434 30068
+.word 435 35485
+.word 436 2834
+.word 437 25315
+.word 438 29920
+.word 439 13209
+.word 440 50782
+.word 441 19007
+.word 442 65292
+.word 443 28757
+.word 444 60010
+.word 445 19291
+.word 446 65528
+.word 447 48337
+.word 448 17206
+.word 449 16951
+.word 450 9124
+.word 451 21773
+.word 452 23746
+.word 453 51923
+.word 454 54800
+.word 455 13577
+.word 456 33550
+.word 457 16687
+.word 458 17212
+.word 459 6341
+.word 460 49690
+.word 461 49483
+.word 462 22312
+.word 463 31809
+.word 464 58854
+.word 465 10023
+.word 466 48596
+.word 467 39805
+.word 468 31346
+.word 469 3779
+.word 470 58176
+.word 471 29305
+.word 472 52158
+.word 473 54303
+.word 474 62316
+.word 475 48437
+.word 476 58826
+.word 477 37691
+.word 478 55896
+.word 479 63409
+.word 480 38038
+.word 481 10263
+.word 482 17412
+.word 483 24045
+.word 484 25634
+.word 485 11955
+.word 486 40048
+.word 487 60393
+.word 488 41070
+.word 489 783
+.word 490 3996
+.word 491 23973
+.word 492 21882
+.word 493 49451
+.word 494 35208
+.word 495 12065
+.word 496 20294
+.word 497 17671
+.word 498 46644
+.word 499 40029
+.word 500 6610
+.word 501 10915
+.word 502 416
+.word 503 41305
+.word 504 286
+.word 505 52735
+.word 506 38860
+.word 507 64021
+.word 508 4394
+.word 509 19227
+.word 510 25784
+.word 511 8849
+.word 512 5622
+.word 513 32247
+.word 514 5220
+.word 515 22221
+.word 516 39810
+.word 517 659
+.word 518 4816
+.word 519 37577
+.word 520 60878
+.word 521 13551
+.word 522 35836
+.word 523 37509
+.word 524 6362
+.word 525 12555
+.word 526 27624
+.word 527 53761
+.word 528 59558
+.word 529 53991
+.word 530 24212
+.word 531 36157
+.word 532 59698
+.word 533 46723
+.word 534 53248
+.word 535 49209
+.word 536 26238
+.word 537 14303
+.word 538 60460
+.word 539 9973
+.word 540 27786
+.word 541 29435
+.word 542 40728
+.word 543 15729
+.word 544 51030
+.word 545 17367
+.word 546 38084
+.word 547 16301
+.word 548 738
+.word 549 18035
+.word 550 14640
+.word 551 10665
+.word 552 27438
+.word 553 54991
+.word 554 47196
+.word 555 46949
+.word 556 3130
+.word 557 4331
+.word 558 65096
+.word 559 25825
+.word 560 45574
+.word 561 53447
+.word 562 46836
+.word 563 28189
+.word 564 59538
+.word 565 45667
+.word 566 20064
+.word 567 53017
+.word 568 64478
+.word 569 4543
+.word 570 61580
+.word 571 17365
+.word 572 63466
+.word 573 2779
+.word 574 35192
+.word 575 18513
+.word 576 43190
+.word 577 31159
+.word 578 50468
+.word 579 6285
+.word 580 39490
+.word 581 64083
+.word 582 3984
+.word 583 45193
+.word 584 6286
+.word 585 59567
+.word 586 38076
+.word 587 52293
+.word 588 12186
+.word 589 24779
+.word 590 16552
+.word 591 59329
+.word 592 43878
+.word 593 16039
+.word 594 48980
+.word 595 16125
+.word 596 6130
+.word 597 7747
+.word 598 31936
+.word 599 52729
+.word 600 49470
+.word 601 23455
+.word 602 42220
+.word 603 20661
+.word 604 45898
+.word 605 4795
+.word 606 9176
+.word 607 17201
+.word 608 47638
+.word 609 8087
+.word 610 42372
+.word 611 57709
+.word 612 24994
+.word 613 7731
+.word 614 38384
+.word 615 10089
+.word 616 62958
+.word 617 27279
+.word 618 8476
+.word 619 53541
+.word 620 33530
+.word 621 8363
+.word 622 13064
+.word 623 23201
+.word 624 54470
+.word 625 7303
+.word 626 30644
+.word 627 65501
+.word 628 30546
+.word 629 64035
+.word 630 23328
+.word 631 48345
+.word 632 46750
+.word 633 5503
+.word 634 2380
+.word 635 19861
+.word 636 40618
+.word 637 35483
+.word 638 28216
+.word 639 11793
+.word 640 64374
+.word 641 13687
+.word 642 13796
+.word 643 39501
+.word 644 22786
+.word 645 45587
+.word 646 52304
+.word 647 36425
+.word 648 846
+.word 649 23663
+.word 650 23932
+.word 651 50693
+.word 652 1626
+.word 653 20619
+.word 654 54632
+.word 655 48513
+.word 656 11814
+.word 657 27239
+.word 658 57364
+.word 659 45245
+.word 660 1714
+.word 661 17923
+.word 662 59776
+.word 663 39865
+.word 664 56318
+.word 665 16223
+.word 666 7596
+.word 667 14965
+.word 668 47626
+.word 669 29307
+.word 670 26776
+.word 671 2289
+.word 672 27862
+.word 673 47959
+.word 674 30276
+.word 675 17197
+.word 676 32866
+.word 677 46579
+.word 678 45744
+.word 679 58665
+.word 680 16558
+.word 681 48719
+.word 682 18908
+.word 683 43749
+.word 684 47546
+.word 685 61547
+.word 686 10184
+.word 687 4193
+.word 688 46982
+.word 689 10311
+.word 690 63604
+.word 691 20893
+.word 692 50706
+.word 693 483
+.word 694 10208
+.word 695 27289
+.word 696 12638
+.word 697 55615
+.word 698 57868
+.word 699 5973
+.word 700 1386
+.word 701 51803
+.word 702 4856
+.word 703 54225
+.word 704 3638
+.word 705 45367
+.word 706 26276
+.word 707 56333
+.word 708 55234
+.word 709 10707
+.word 710 18704
+.word 711 11273
+.word 712 44558
+.word 713 36911
+.word 714 58940
+.word 715 32709
+.word 716 40218
+.word 717 75
+.word 718 10792
+.word 719 21313
+.word 720 28902
+.word 721 22055
+.word 722 49364
+.word 723 57981
+.word 724 46450
+.word 725 11715
+.word 726 5696
+.word 727 10617
+.word 728 46782
+.word 729 58143
+.word 730 22124
+.word 731 58421
+.word 732 32970
+.word 733 37435
+.word 734 27992
+.word 735 36529
+.word 736 57238
+.word 737 5911
+.word 738 1796
+.word 739 25837
+.word 740 24354
+.word 741 3507
+.word 742 36720
+.word 743 25321
+.word 744 19310
+.word 745 53775
+.word 746 12956
+.word 747 17573
+.word 748 45178
+.word 749 32811
+.word 750 56456
+.word 751 34337
+.word 752 23110
+.word 753 62471
+.word 754 14644
+.word 755 25437
+.word 756 54482
+.word 757 51619
+.word 758 46240
+.word 759 55385
+.word 760 27678
+.word 761 23807
+.word 762 31436
+.word 763 41237
+.word 764 11306
+.word 765 51739
+.word 766 30648
+.word 767 14737
+.word 768 57590
+.word 769 60663
+.word 770 22372
+.word 771 56781
+.word 772 5762
+.word 773 24979
+.word 774 34256
+.word 775 35273
+.word 776 6350
+.word 777 33775
+.word 778 12028
+.word 779 63877
+.word 780 62426
+.word 781 28683
+.word 782 16104
+.word 783 43265
+.word 784 29606
+.word 785 487
+.word 786 24980
+.word 787 54333
+.word 788 9266
+.word 789 54659
+.word 790 768
+.word 791 30521
+.word 792 20862
+.word 793 18143
+.word 794 20268
+.word 795 19957
+.word 796 1930
+.word 797 29179
+.word 798 12824
+.word 799 54385
+.word 800 4694
+.word 801 13015
+.word 802 22468
+.word 803 18093
+.word 804 64994
+.word 805 9587
+.word 806 11312
+.word 807 41129
+.word 808 5678
+.word 809 42447
+.word 810 56156
+.word 811 40549
+.word 812 26426
+.word 813 53227
+.word 814 20808
+.word 815 48097
+.word 816 48390
+.word 817 32711
+.word 818 14836
+.word 819 13597
+.word 820 41874
+.word 821 20835
+.word 822 352
+.word 823 1561
+.word 824 26334
+.word 825 41151
+.word 826 54156
+.word 827 60117
+.word 828 4842
+.word 829 35291
+.word 830 40056
+.word 831 24401
+.word 832 29622
+.word 833 59575
+.word 834 2084
+.word 835 40845
+.word 836 5442
+.word 837 22867
+.word 838 33424
+.word 839 42889
+.word 840 17294
+.word 841 14255
+.word 842 14268
+.word 843 13125
+.word 844 2714
+.word 845 40907
+.word 846 5032
+.word 847 48833
+.word 848 13926
+.word 849 28071
+.word 850 49748
+.word 851 34301
+.word 852 21234
+.word 853 15683
+.word 854 44992
+.word 855 34041
+.word 856 44094
+.word 857 27295
+.word 858 2028
+.word 859 30645
+.word 860 20042
+.word 861 4539
+.word 862 46808
+.word 863 55857
+.word 864 1302
+.word 865 3735
+.word 866 26756
+.word 867 59501
+.word 868 23714
+.word 869 64819
+.word 870 35056
+.word 871 40553
+.word 872 41198
+.word 873 14735
+.word 874 17436
+.word 875 47141
+.word 876 56826
+.word 877 57259
+.word 878 34312
+.word 879 45473
+.word 880 57286
+.word 881 52103
+.word 882 64180
+.word 883 50909
+.word 884 12882
+.word 885 39203
+.word 886 3616
+.word 887 62425
+.word 888 8606
+.word 889 42111
+.word 890 60492
+.word 891 62613
+.word 892 47530
+.word 893 2459
+.word 894 33080
+.word 895 17681
+.word 896 50806
+.word 897 42103
+.word 898 30948
+.word 899 8525
+.word 900 54274
+.word 901 4371
+.word 902 16208
+.word 903 34121
+.word 904 11854
+.word 905 43887
+.word 906 124
+.word 907 11525
+.word 908 57690
+.word 909 36747
+.word 910 43112
+.word 911 38017
+.word 912 47398
+.word 913 39271
+.word 914 58132
+.word 915 63421
+.word 916 16818
+.word 917 25859
+.word 918 7296
+.word 919 21177
+.word 920 50942
+.word 921 20063
+.word 922 32940
+.word 923 24949
+.word 924 21770
+.word 925 29051
+.word 926 64408
+.word 927 40945
+.word 928 47062
+.word 929 43607
+.word 930 14660
+.word 931 18989
+.word 932 31586
+.word 933 38131
+.word 934 42416
+.word 935 23593
+.word 936 60334
+.word 937 36175
+.word 938 27868
+.word 939 37349
+.word 940 5306
+.word 941 44907
+.word 942 31432
+.word 943 26465
+.word 944 49798
+.word 945 55111
+.word 946 31604
+.word 947 6301
+.word 948 33042
+.word 949 41187
+.word 950 56032
+.word 951 41369
+.word 952 40030
+.word 953 26687
+.word 954 50444
+.word 955 48725
+.word 956 8298
+.word 957 18779
+.word 958 9720
+.word 959 60113
+.word 960 55606
+.word 961 8247
+.word 962 43428
+.word 963 25357
+.word 964 21186
+.word 965 35027
+.word 966 48144
+.word 967 8969
+.word 968 55566
+.word 969 57135
+.word 970 35132
+.word 971 59077
+.word 972 30746
+.word 973 16203
+.word 974 64808
+.word 975 10817
+.word 976 64486
+.word 977 34087
+.word 978 50132
+.word 979 10621
+.word 980 61554
+.word 981 19651
+.word 982 18752
+.word 983 57465
+.word 984 41406
+.word 985 61983
+.word 986 47468
+.word 987 2869
+.word 988 7114
+.word 989 37179
+.word 990 88
+.word 991 9649
+.word 992 10902
+.word 993 1559
+.word 994 51716
+.word 995 27629
+.word 996 23074
+.word 997 60595
+.word 998 33392
+.word 999 55785
+.word 1000 63086
+.word 1001 41231
+.word 1002 21916
+.word 1003 11173
+.word 1004 2938
+.word 1005 16171
+.word 1006 12168
+.word 1007 56609
+.word 1008 25926
+.word 1009 41735
+.word 1010 48180
+.word 1011 10845
+.word 1012 36818
+.word 1013 26787
+.word 1014 26528
+.word 1015 3929
+.word 1016 55070
+.word 1017 60415
+.word 1018 24012
+.word 1019 18453
+.word 1020 18218
+.word 1021 18715
+.word 1022 35512
+.word 1023 20625
+.word 1024 44022
+.word 1025 23543
+.word 1026 39524
+.word 1027 25805
+.word 1028 37250
+.word 1029 49299
+.word 1030 63696
+.word 1031 32969
+.word 1032 17358
+.word 1033 53999
+.word 1034 53756
+.word 1035 24709
+.word 1036 52954
+.word 1037 44811
+.word 1038 4584
+.word 1039 32769
+.word 1040 65190
+.word 1041 12519
+.word 1042 25748
+.word 1043 6973
+.word 1044 24370
+.word 1045 62595
+.word 1046 13824
+.word 1047 11833
+.word 1048 15486
+.word 1049 21983
+.word 1050 45612
+.word 1051 29941
+.word 1052 41610
+.word 1053 28923
+.word 1054 50456
+.word 1055 27505
+.word 1056 23894
+.word 1057 8663
+.word 1058 6852
+.word 1059 19885
+.word 1060 63714
+.word 1061 1139
+.word 1062 7984
+.word 1063 6057
+.word 1064 49454
+.word 1065 29903
+.word 1066 65116
+.word 1067 34149
+.word 1068 49722
+.word 1069 36587
+.word 1070 42056
+.word 1071 4833
+.word 1072 51206
+.word 1073 11975
+.word 1074 48372
+.word 1075 64541
+.word 1076 24210
+.word 1077 61539
+.word 1078 46176
+.word 1079 15641
+.word 1080 53726
+.word 1081 12223
+.word 1082 46732
+.word 1083 37333
+.word 1084 11754
+.word 1085 2267
+.word 1086 44920
+.word 1087 30289
+.word 1088 16054
+.word 1089 22455
+.word 1090 19236
+.word 1091 9869
+.word 1092 36930
+.word 1093 47187
+.word 1094 62864
+.word 1095 40585
+.word 1096 28302
+.word 1097 34479
+.word 1098 55996
+.word 1099 39493
+.word 1100 58778
+.word 1101 57035
+.word 1102 59048
+.word 1103 38337
+.word 1104 49510
+.word 1105 40103
+.word 1106 50516
+.word 1107 52477
+.word 1108 36338
+.word 1109 23619
+.word 1110 58048
+.word 1111 15353
+.word 1112 38718
+.word 1113 31135
+.word 1114 27372
+.word 1115 40629
+.word 1116 59722
+.word 1117 4283
+.word 1118 18904
+.word 1119 28977
+.word 1120 20502
+.word 1121 64919
+.word 1122 11140
+.word 1123 61293
+.word 1124 22434
+.word 1125 56371
+.word 1126 31728
+.word 1127 5481
+.word 1128 19438
+.word 1129 2191
+.word 1130 26396
+.word 1131 40741
+.word 1132 14586
+.word 1133 40619
+.word 1134 55560
+.word 1135 2209
+.word 1136 60102
+.word 1137 31367
+.word 1138 32180
+.word 1139 36317
+.word 1140 60754
+.word 1141 14371
+.word 1142 49440
+.word 1143 10969
+.word 1144 35998
+.word 1145 13183
+.word 1146 53068
+.word 1147 39829
+.word 1148 54442
+.word 1149 34971
+.word 1150 37944
+.word 1151 23569
+.word 1152 37238
+.word 1153 4983
+.word 1154 48100
+.word 1155 43085
+.word 1156 20226
+.word 1157 28691
+.word 1158 45648
+.word 1159 31817
+.word 1160 22862
+.word 1161 64111
+.word 1162 41852
+.word 1163 37893
+.word 1164 48218
+.word 1165 52875
+.word 1166 31592
+.word 1167 27521
+.word 1168 17446
+.word 1169 51303
+.word 1170 58900
+.word 1171 16061
+.word 1172 31922
+.word 1173 33795
+.word 1174 20352
+.word 1175 2489
+.word 1176 45566
+.word 1177 23903
+.word 1178 58284
+.word 1179 34933
+.word 1180 61450
+.word 1181 28795
+.word 1182 36504
+.word 1183 14065
+.word 1184 726
+.word 1185 39255
+.word 1186 64580
+.word 1187 20781
+.word 1188 30306
+.word 1189 29683
+.word 1190 39088
+.word 1191 54057
+.word 1192 38574
+.word 1193 23631
+.word 1194 36828
+.word 1195 30949
+.word 1196 28602
+.word 1197 28267
+.word 1198 52680
+.word 1199 48737
+.word 1200 52614
+.word 1201 34375
+.word 1202 65140
+.word 1203 57245
+.word 1204 15378
+.word 1205 16355
+.word 1206 36320
+.word 1207 55449
+.word 1208 1886
+.word 1209 63295
+.word 1210 43020
+.word 1211 25941
+.word 1212 15210
+.word 1213 51291
+.word 1214 14584
+.word 1215 465
+.word 1216 42038
+.word 1217 36663
+.word 1218 60580
+.word 1219 59917
+.word 1220 52674
+.word 1221 59347
+.word 1222 12048
+.word 1223 6665
+.word 1224 1038
+.word 1225 11823
+.word 1226 11324
+.word 1227 19909
+.word 1228 21274
+.word 1229 32331
+.word 1230 53288
+.word 1231 321
+.word 1232 34534
+.word 1233 46119
+.word 1234 50900
+.word 1235 28797
+.word 1236 11122
+.word 1237 27587
+.word 1238 31808
+.word 1239 38777
+.word 1240 36030
+.word 1241 287
+.word 1242 7276
+.word 1243 12853
+.word 1244 46794
+.word 1245 36923
+.word 1246 37720
+.word 1247 48305
+.word 1248 30102
+.word 1249 62743
+.word 1250 36100
+.word 1251 29421
+.word 1252 21794
+.word 1253 52147
+.word 1254 30064
+.word 1255 20713
+.word 1256 41326
+.word 1257 28687
+.word 1258 30876
+.word 1259 4773
+.word 1260 26234
+.word 1261 65067
+.word 1262 33416
+.word 1263 13345
+.word 1264 28742
+.word 1265 20999
+.word 1266 16180
+.word 1267 61789
+.word 1268 19154
+.word 1269 1955
+.word 1270 6816
+.word 1271 18009
+.word 1272 16926
+.word 1273 31487
+.word 1274 16588
+.word 1275 61205
+.word 1276 25130
+.word 1277 51227
+.word 1278 40376
+.word 1279 26513
+.word 1280 30454
+.word 1281 51959
+.word 1282 56676
+.word 1283 60365
+.word 1284 3202
+.word 1285 8083
+.word 1286 27600
+.word 1287 30665
+.word 1288 28366
+.word 1289 8687
+.word 1290 29948
+.word 1291 51077
+.word 1292 43482
+.word 1293 60939
+.word 1294 58600
+.word 1295 22273
+.word 1296 35238
+.word 1297 24551
+.word 1298 26516
+.word 1299 25149
+.word 1300 39474
+.word 1301 4995
+.word 1302 26880
+.word 1303 58681
+.word 1304 10110
+.word 1305 25823
+.word 1306 5420
+.word 1307 39925
+.word 1308 15754
+.word 1309 28667
+.word 1310 22552
+.word 1311 625
+.word 1312 43094
+.word 1313 4311
+.word 1314 56772
+.word 1315 21677
+.word 1316 62434
+.word 1317 58227
+.word 1318 4656
+.word 1319 36521
+.word 1320 27694
+.word 1321 17359
+.word 1322 8540
+.word 1323 27749
+.word 1324 7482
+.word 1325 19947
+.word 1326 63304
+.word 1327 27105
+.word 1328 54022
+.word 1329 56775
+.word 1330 16372
+.word 1331 49949
+.word 1332 6546
+.word 1333 36707
+.word 1334 26464
+.word 1335 29721
+.word 1336 15582
+.word 1337 48831
+.word 1338 39308
+.word 1339 14549
+.word 1340 18666
+.word 1341 34779
+.word 1342 49784
+.word 1343 36177
+.word 1344 2486
+.word 1345 50871
+.word 1346 36388
+.word 1347 44429
+.word 1348 2882
+.word 1349 5971
+.word 1350 26768
+.word 1351 38281
+.word 1352 39310
+.word 1353 54703
+.word 1354 32188
+.word 1355 325
+.word 1356 49306
+.word 1357 7627
+.word 1358 47528
+.word 1359 27841
+.word 1360 19558
+.word 1361 52135
+.word 1362 51284
+.word 1363 5117
+.word 1364 51442
+.word 1365 31555
+.word 1366 5568
+.word 1367 62201
+.word 1368 33342
+.word 1369 34975
+.word 1370 52716
+.word 1371 50613
+.word 1372 33866
+.word 1373 4027
+.word 1374 56536
+.word 1375 2097
+.word 1376 39702
+.word 1377 60567
+.word 1378 61060
+.word 1379 63085
+.word 1380 21154
+.word 1381 47923
+.word 1382 28400
+.word 1383 35945
+.word 1384 63214
+.word 1385 55183
+.word 1386 35356
+.word 1387 34341
+.word 1388 37882
+.word 1389 23979
+.word 1390 11272
+.word 1391 24481
+.word 1392 62918
+.word 1393 10631
+.word 1394 180
+.word 1395 21725
+.word 1396 43090
+.word 1397 55075
+.word 1398 29728
+.word 1399 25049
+.word 1400 63390
+.word 1401 49791
+.word 1402 45644
+.word 1403 17045
+.word 1404 61354
+.word 1405 1947
+.word 1406 42808
+.word 1407 29457
+.word 1408 23670
+.word 1409 33399
+.word 1410 65252
+.word 1411 12109
+.word 1412 51714
+.word 1413 53011
+.word 1414 9552
+.word 1415 29513
+.word 1416 33870
+.word 1417 18799
+.word 1418 18044
+.word 1419 64261
+.word 1420 38746
+.word 1421 3467
+.word 1422 20072
+.word 1423 17025
+.word 1424 53030
+.word 1425 63335
+.word 1426 59668
+.word 1427 34237
+.word 1428 47026
+.word 1429 41731
+.word 1430 33408
+.word 1431 49337
+.word 1432 40190
+.word 1433 27743
+.word 1434 18092
+.word 1435 44917
+.word 1436 35594
+.word 1437 28539
+.word 1438 8600
+.word 1439 52721
+.word 1440 19926
+.word 1441 34903
+.word 1442 48964
+.word 1443 22573
+.word 1444 29026
+.word 1445 21235
+.word 1446 35760
+.word 1447 18985
+.word 1448 16814
+.word 1449 11087
+.word 1450 45788
+.word 1451 24549
+.word 1452 51898
+.word 1453 11627
+.word 1454 8392
+.word 1455 5473
+.word 1456 55430
+.word 1457 13639
+.word 1458 33140
+.word 1459 42653
+.word 1460 63250
+.word 1461 57059
+.word 1462 16608
+.word 1463 3993
+.word 1464 29278
+.word 1465 34367
+.word 1466 35596
+.word 1467 3157
+.word 1468 22122
+.word 1469 18267
+.word 1470 19448
+.word 1471 6353
+.word 1472 28470
+.word 1473 65079
+.word 1474 12196
+.word 1475 28941
+.word 1476 18626
+.word 1477 18131
+.word 1478 41488
+.word 1479 4361
+.word 1480 12046
+.word 1481 32047
+.word 1482 53052
+.word 1483 46277
+.word 1484 11802
+.word 1485 48459
+.word 1486 41768
+.word 1487 55361
+.word 1488 4582
+.word 1489 58151
+.word 1490 51668
+.word 1491 46973
+.word 1492 26226
+.word 1493 35523
+.word 1494 44864
+.word 1495 20089
+.word 1496 30654
+.word 1497 4127
+.word 1498 32620
+.word 1499 22837
+.word 1500 20938
+.word 1501 36667
+.word 1502 9816
+.word 1503 21425
+.word 1504 49302
+.word 1505 58391
+.word 1506 20484
+.word 1507 31213
+.word 1508 20514
+.word 1509 43699
+.word 1510 26736
+.word 1511 51177
+.word 1512 19566
+.word 1513 16143
+.word 1514 39836
+.word 1515 63909
+.word 1516 49530
+.word 1517 48427
+.word 1518 54664
+.word 1519 35617
+.word 1520 31558
+.word 1521 263
+.word 1522 49716
+.word 1523 47197
+.word 1524 1490
+.word 1525 42659
+.word 1526 52640
+.word 1527 32089
+.word 1528 44318
+.word 1529 2559
+.word 1530 9164
+.word 1531 38421
+.word 1532 32042
+.word 1533 18203
+.word 1534 45240
+.word 1535 32401
+.word 1536 16886
+.word 1537 14839
+.word 1538 8292
+.word 1539 29389
+.word 1540 34690
+.word 1541 32403
+.word 1542 57040
+.word 1543 28361
+.word 1544 39374
+.word 1545 28911
+.word 1546 6140
+.word 1547 11909
+.word 1548 34010
+.word 1549 11531
+.word 1550 47080
+.word 1551 11777
+.word 1552 5286
+.word 1553 36583
+.word 1554 27284
+.word 1555 43325
+.word 1556 54578
+.word 1557 12931
+.word 1558 39936
+.word 1559 39993
+.word 1560 4734
+.word 1561 29663
+.word 1562 30764
+.word 1563 49909
+.word 1564 55434
+.word 1565 28411
+.word 1566 60184
+.word 1567 39281
+.word 1568 62294
+.word 1569 65495
+.word 1570 41156
+.word 1571 23469
+.word 1572 61154
+.word 1573 49779
+.word 1574 1328
+.word 1575 1449
+.word 1576 5934
+.word 1577 4815
+.word 1578 17500
+.word 1579 21349
+.word 1580 30778
+.word 1581 3307
+.word 1582 19016
+.word 1583 49377
+.word 1584 56838
+.word 1585 36039
+.word 1586 49908
+.word 1587 35357
+.word 1588 54418
+.word 1589 11875
+.word 1590 6752
+.word 1591 43801
+.word 1592 42974
+.word 1593 19903
+.word 1594 31884
+.word 1595 57301
+.word 1596 25578
+.word 1597 1755
+.word 1598 54648
+.word 1599 42065
+.word 1600 54454
+.word 1601 13751
+.word 1602 53540
+.word 1603 13453
+.word 1604 34370
+.word 1605 30291
+.word 1606 56208
+.word 1607 35977
+.word 1608 50318
+.word 1609 9391
+.word 1610 8380
+.word 1611 26693
+.word 1612 39834
+.word 1613 23755
+.word 1614 36008
+.word 1615 17345
+.word 1616 55142
+.word 1617 64167
+.word 1618 52052
+.word 1619 23293
+.word 1620 1010
+.word 1621 39491
+.word 1622 18624
+.word 1623 43513
+.word 1624 27966
+.word 1625 38815
+.word 1626 12524
+.word 1627 60597
+.word 1628 8010
+.word 1629 3771
+.word 1630 28632
+.word 1631 40753
+.word 1632 58902
+.word 1633 56215
+.word 1634 45444
+.word 1635 64877
+.word 1636 19874
+.word 1637 39475
+.word 1638 25072
+.word 1639 873
+.word 1640 41454
+.word 1641 42639
+.word 1642 44316
+.word 1643 27941
+.word 1644 61178
+.word 1645 7339
+.word 1646 32520
+.word 1647 46753
+.word 1648 198
+.word 1649 55431
+.word 1650 33716
+.word 1651 7133
+.word 1652 25426
+.word 1653 30243
+.word 1654 10016
+.word 1655 39129
+.word 1656 25246
+.word 1657 20863
+.word 1658 38220
+.word 1659 59797
+.word 1660 2730
+.word 1661 34459
+.word 1662 47672
+.word 1663 35345
+.word 1664 10102
+.word 1665 61815
+.word 1666 16868
+.word 1667 46669
+.word 1668 17666
+.word 1669 11795
+.word 1670 38992
+.word 1671 27209
+.word 1672 44878
+.word 1673 39023
+.word 1674 59772
+.word 1675 25093
+.word 1676 29274
+.word 1677 19595
+.word 1678 8552
+.word 1679 6529
+.word 1680 23078
+.word 1681 9831
+.word 1682 60436
+.word 1683 52413
+.word 1684 62130
+.word 1685 49667
+.word 1686 46464
+.word 1687 30649
+.word 1688 34814
+.word 1689 31583
+.word 1690 43436
+.word 1691 54901
+.word 1692 9738
+.word 1693 28283
+.word 1694 46232
+.word 1695 25841
+.word 1696 39126
+.word 1697 30551
+.word 1698 33348
+.word 1699 24365
+.word 1700 27746
+.word 1701 12787
+.word 1702 32432
+.word 1703 49449
+.word 1704 60590
+.word 1705 64079
+.word 1706 54748
+.word 1707 18149
+.word 1708 9658
+.word 1709 60523
+.word 1710 29640
+.word 1711 27745
+.word 1712 58246
+.word 1713 58439
+.word 1714 1140
+.word 1715 28061
+.word 1716 45586
+.word 1717 32227
+.word 1718 62432
+.word 1719 18073
+.word 1720 56670
+.word 1721 5439
+.word 1722 28172
+.word 1723 45909
+.word 1724 29034
+.word 1725 50779
+.word 1726 24312
+.word 1727 12241
+.word 1728 14902
+.word 1729 27959
+.word 1730 29348
+.word 1731 63501
+.word 1732 50114
+.word 1733 42451
+.word 1734 5392
+.word 1735 2057
+.word 1736 23054
+.word 1737 52271
+.word 1738 29244
+.word 1739 7109
+.word 1740 2330
+.word 1741 64587
+.word 1742 30248
+.word 1743 44865
+.word 1744 40166
+.word 1745 4647
+.word 1746 52436
+.word 1747 65149
+.word 1748 41330
+.word 1749 43459
+.word 1750 57920
+.word 1751 1401
+.word 1752 25278
+.word 1753 7967
+.word 1754 57964
+.word 1755 32821
+.word 1756 60618
+.word 1757 36411
+.word 1758 47448
+.word 1759 60081
+.word 1760 2966
+.word 1761 54039
+.word 1762 4868
+.word 1763 33005
+.word 1764 19234
+.word 1765 35251
+.word 1766 23408
+.word 1767 16105
+.word 1768 63342
+.word 1769 3599
+.word 1770 48796
+.word 1771 57509
+.word 1772 7290
+.word 1773 31787
+.word 1774 10376
+.word 1775 57889
+.word 1776 34374
+.word 1777 45063
+.word 1778 17716
+.word 1779 32605
+.word 1780 49362
+.word 1781 17827
+.word 1782 32928
+.word 1783 46169
+.word 1784 6174
+.word 1785 39167
+.word 1786 1740
+.word 1787 15637
+.word 1788 38954
+.word 1789 50715
+.word 1790 50104
+.word 1791 38289
+.word 1792 3318
+.word 1793 43255
+.word 1794 25444
+.word 1795 63949
+.word 1796 642
+.word 1797 56723
+.word 1798 20944
+.word 1799 26057
+.word 1800 50382
+.word 1801 49135
+.word 1802 47868
+.word 1803 38277
+.word 1804 24538
+.word 1805 27659
+.word 1806 35560
+.word 1807 1281
+.word 1808 40870
+.word 1809 48615
+.word 1810 28052
+.word 1811 61501
+.word 1812 4146
+.word 1813 20867
+.word 1814 52992
+.word 1815 21305
+.word 1816 64894
+.word 1817 33503
+.word 1818 56108
+.word 1819 59893
+.word 1820 29578
+.word 1821 28155
+.word 1822 32280
+.word 1823 12401
+.word 1824 15958
+.word 1825 61143
+.word 1826 25540
+.word 1827 25261
+.word 1828 59874
+.word 1829 41331
+.word 1830 63536
+.word 1831 31913
+.word 1832 49710
+.word 1833 57807
+.word 1834 26460
+.word 1835 14949
+.word 1836 54074
+.word 1837 52203
+.word 1838 40264
+.word 1839 6113
+.word 1840 59654
+.word 1841 15303
+.word 1842 17908
+.word 1843 20765
+.word 1844 36754
+.word 1845 52579
+.word 1846 52576
+.word 1847 57881
+.word 1848 4830
+.word 1849 56511
+.word 1850 24460
+.word 1851 34517
+.word 1852 32490
+.word 1853 34267
+.word 1854 59512
+.word 1855 47953
+.word 1856 40886
+.word 1857 42167
+.word 1858 5156
+.word 1859 48013
+.word 1860 322
+.word 1861 54611
+.word 1862 20112
+.word 1863 33673
+.word 1864 61326
+.word 1865 29615
+.word 1866 50108
+.word 1867 53061
+.word 1868 30362
+.word 1869 39883
+.word 1870 24488
+.word 1871 6849
+.word 1872 25190
+.word 1873 10663
+.word 1874 52820
+.word 1875 41469
+.word 1876 16114
+.word 1877 47427
+.word 1878 31680
+.word 1879 24825
+.word 1880 22590
+.word 1881 42655
+.word 1882 37868
+.word 1883 5045
+.word 1884 47690
+.word 1885 3515
+.word 1886 728
+.word 1887 13873
+.word 1888 12566
+.word 1889 51863
+.word 1890 29828
+.word 1891 1133
+.word 1892 18594
+.word 1893 31027
+.word 1894 21744
+.word 1895 31337
+.word 1896 19694
+.word 1897 30095
+.word 1898 53276
+.word 1899 21541
+.word 1900 18938
+.word 1901 56235
+.word 1902 53768
+.word 1903 3489
+.word 1904 3014
+.word 1905 34695
+.word 1906 1716
+.word 1907 58077
+.word 1908 7762
+.word 1909 5411
+.word 1910 55840
+.word 1911 53209
+.word 1912 52638
+.word 1913 57471
+.word 1914 30796
+.word 1915 37013
+.word 1916 9642
+.word 1917 1435
+.word 1918 52536
+.word 1919 41233
+.word 1920 62070
+.word 1921 24695
+.word 1922 34020
+.word 1923 15693
+.word 1924 49154
+.word 1925 36115
+.word 1926 2896
+.word 1927 24905
+.word 1928 55886
+.word 1929 59247
+.word 1930 35964
+.word 1931 51461
+.word 1932 19802
+.word 1933 35723
+.word 1934 62568
+.word 1935 61569
+.word 1936 58662
+.word 1937 21863
+.word 1938 61204
+.word 1939 5053
+.word 1940 11698
+.word 1941 57603
+.word 1942 59520
+.word 1943 11961
+.word 1944 29438
+.word 1945 35423
+.word 1946 3244
+.word 1947 64885
+.word 1948 49418
+.word 1949 28027
+.word 1950 18328
+.word 1951 64497
+.word 1952 58326
+.word 1953 26199
+.word 1954 17732
+.word 1955 26157
+.word 1956 26466
+.word 1957 4339
+.word 1958 29104
+.word 1959 14377
+.word 1960 38830
+.word 1961 51535
+.word 1962 63708
+.word 1963 11749
+.word 1964 32954
+.word 1965 43883
+.word 1966 50888
+.word 1967 50017
+.word 1968 61062
+.word 1969 37703
+.word 1970 34676
+.word 1971 13469
+.word 1972 27922
+.word 1973 7395
+.word 1974 42720
+.word 1975 32153
+.word 1976 18526
+.word 1977 42047
+.word 1978 20748
+.word 1979 23125
+.word 1980 35946
+.word 1981 17755
+.word 1982 29176
+.word 1983 18129
+.word 1984 1334
+.word 1985 56375
+.word 1986 46500
+.word 1987 32525
+.word 1988 16066
+.word 1989 1235
+.word 1990 34832
+.word 1991 65289
+.word 1992 34062
+.word 1993 6959
+.word 1994 5436
+.word 1995 33477
+.word 1996 58394
+.word 1997 15179
+.word 1998 18728
+.word 1999 34369
+.word 2000 10214
+.word 2001 16679
+.word 2002 53204
+.word 2003 17789
+.word 2004 56434
+.word 2005 51395
+.word 2006 5440
+.word 2007 48249
+.word 2008 19902
+.word 2009 11807
+.word 2010 17772
+.word 2011 42805
+.word 2012 34762
+.word 2013 36155
+.word 2014 19544
+.word 2015 33201
+.word 2016 22166
+.word 2017 49687
+.word 2018 54788
+.word 2019 34797
+.word 2020 17954
+.word 2021 26803
+.word 2022 20080
+.word 2023 46569
+.word 2024 41582
+.word 2025 56591
+.word 2026 57756
+.word 2027 51109
+.word 2028 30586
+.word 2029 15147
+.word 2030 31624
+.word 2031 14625
+.word 2032 37190
+.word 2033 24327
+.word 2034 51252
+.word 2035 18013
+.word 2036 31698
+.word 2037 58531
+.word 2038 13216
+.word 2039 60249
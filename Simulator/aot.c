@@ -0,0 +1,167 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "aot.h"
+
+/*
+  description:
+	1 if the instruction is translated. the rest (in/out/reti/halt, writes to $zero/$imm, invalid opcodes) always go
+	through the interpreter.
+
+*/
+static int translatable(const decoded_instruction_t* inst) {
+
+	if (inst->opcode <= 8 || inst->opcode == 15 || inst->opcode == 16) {
+		return inst->rd >= 3;
+	}
+
+	return inst->opcode <= 17;
+}
+
+/*
+  description:
+	writes a jump to the address held in register rm. $zero/$imm1/$imm2 are constant and jump to the label directly.
+
+*/
+static void write_jump(FILE* fptr, const decoded_instruction_t* inst, int rm, int length) {
+
+	int target;
+
+	if (rm > 2) {
+		fprintf(fptr, "{ PC = R[%d] & PC_MASK; goto dispatch; }\n", rm);
+		return;
+	}
+
+	target = rm == 0 ? 0 : ((rm == 1 ? inst->imm1 : inst->imm2) & PC_MASK);
+
+	if (target < length)
+		fprintf(fptr, "goto L_%d;\n", target);
+	else
+		fprintf(fptr, "{ PC = %d; goto dispatch; }\n", target);
+}
+
+static void write_instruction(FILE* fptr, const decoded_instruction_t* inst, int pc, int length) {
+
+	static const char* alu_format[9] = {
+		"R[%d] = (int32_t)(U(%d) + U(%d) + U(%d));\n",
+		"R[%d] = (int32_t)(U(%d) - U(%d) - U(%d));\n",
+		"R[%d] = (int32_t)(U(%d) * U(%d) - U(%d));\n",
+		"R[%d] = R[%d] & R[%d] & R[%d];\n",
+		"R[%d] = R[%d] | R[%d] | R[%d];\n",
+		"R[%d] = R[%d] ^ R[%d] ^ R[%d];\n",
+		"R[%d] = (int32_t)(U(%d) << (R[%d] & 31));\n",
+		"R[%d] = R[%d] >> (R[%d] & 31);\n",
+		"R[%d] = (int32_t)(U(%d) >> (R[%d] & 31));\n"
+	};
+	static const char* branch_condition[6] = { "==", "!=", "<", ">", "<=", ">=" };
+
+	if (!translatable(inst)) {
+		fprintf(fptr, "L_%d:\tPC = %d; goto interpret;\n", pc, pc);
+		return;
+	}
+
+	fprintf(fptr, "L_%d:\tBEGIN(%d, %d, %d)\n", pc, pc, inst->imm1, inst->imm2);
+
+	if (inst->opcode == 16 || inst->opcode == 17) {
+		fprintf(fptr, "\tINDEX(%d, %d, %d)\n", pc, inst->rs, inst->rt);
+	}
+
+	fprintf(fptr, "\tTRACE(%d)\n\t", pc);
+
+	if (inst->opcode <= 8) {
+		fprintf(fptr, alu_format[inst->opcode], inst->rd, inst->rs, inst->rt, inst->opcode < 6 ? inst->rm : 0);
+	}
+	else if (inst->opcode <= 14) {
+
+		if (inst->rs != inst->rt) {
+			fprintf(fptr, "if (R[%d] %s R[%d]) ", inst->rs, branch_condition[inst->opcode - 9], inst->rt);
+			write_jump(fptr, inst, inst->rm, length);
+		}
+		else if (inst->opcode == 9 || inst->opcode >= 13) {     // beq/ble/bge of a register with itself always jump.
+			write_jump(fptr, inst, inst->rm, length);
+		}
+		else {
+			fprintf(fptr, ";\n");
+		}
+	}
+	else if (inst->opcode == 15) {
+		fprintf(fptr, "R[%d] = %d;\n\t", inst->rd, pc + 1);
+		write_jump(fptr, inst, inst->rm, length);
+	}
+	else if (inst->opcode == 16) {
+		fprintf(fptr, "R[%d] = (int32_t)(dmem[index] + U(%d));\n", inst->rd, inst->rm);
+	}
+	else {
+		fprintf(fptr, "dmem[index] = U(%d) + U(%d);\n", inst->rm, inst->rd);
+	}
+}
+
+/*
+  description:
+	writes the program in imem as a C file defining run_aot. the file embeds the instruction text it was generated from
+	and refuses to run against a different imemin.
+
+	parameters:
+	in imem - imemin text, as returned by readfile.
+	in decoded - predecoded imem.
+	in c_fname - output file name.
+
+*/
+void translate_to_c(const char* imem, const decoded_instruction_t* decoded, char* c_fname) {
+
+	FILE* fptr;
+	int length = program_length(imem);
+	int pc;
+
+	fopen_s(&fptr, c_fname, "w");
+
+	if (fptr == NULL) {
+		printf("IO error encountered\nTerminating program...");
+		exit(-1);
+	}
+
+	fprintf(fptr, "/*\n  description:\n\tgenerated by Simulator --translate, do not edit.\n");
+	fprintf(fptr, "\tbuild together with the simulator sources and SIMP_AOT defined, run with --engine=aot.\n\n*/\n");
+	fprintf(fptr, "#include <stdlib.h>\n#include <stdio.h>\n#include <string.h>\n\n#include \"aot.h\"\n\n");
+
+	fprintf(fptr, "#define AOT_LENGTH %d\n\nstatic const char aot_imem[AOT_LENGTH * IMEM_LINE_SIZE + 1] =\n", length);
+	for (pc = 0; pc < length; pc++) {
+		fprintf(fptr, "\t\"%.*s\"%s\n", IMEM_LINE_SIZE, imem + pc * IMEM_LINE_SIZE, pc == length - 1 ? ";" : "");
+	}
+	if (length == 0) {
+		fprintf(fptr, "\t\"\";\n");
+	}
+
+	fprintf(fptr, "\n#define U(r)\t\t\t\t((uint32_t)R[r])\n");
+	fprintf(fptr, "#define BEGIN(pc, imm1, imm2)\tif (budget == 0) { PC = pc; goto interpret; } R[1] = imm1; R[2] = imm2;\n");
+	fprintf(fptr, "#define INDEX(pc, rs, rt)\tindex = U(rs) + U(rt); if (index >= MEM_SIZE) { PC = pc; goto interpret; }\n");
+	fprintf(fptr, "#define TRACE(pc)\t\t\tif (sim->trace_enabled) write_trace(sim, pc, sim->clock + (start - budget)); budget--;\n\n");
+
+	fprintf(fptr, "void run_aot(simulator_t* sim) {\n\n");
+	fprintf(fptr, "\tint32_t* R = sim->state.R;\n\tuint32_t* dmem = sim->state.dmem;\n\tuint32_t PC = sim->state.PC;\n");
+	fprintf(fptr, "\tint64_t budget, start;\n\tuint32_t index;\n\tconst decoded_instruction_t* inst;\n\n");
+	fprintf(fptr, "\tif (memcmp(sim->imem, aot_imem, AOT_LENGTH * IMEM_LINE_SIZE) != 0) {\n");
+	fprintf(fptr, "\t\tprintf(\"imemin does not match the translated program\\nTerminating program...\");\n\t\texit(-1);\n\t}\n\n");
+	fprintf(fptr, "\tbudget = start = quiet_cycles(sim);\n\n");
+
+	fprintf(fptr, "dispatch:\n\tswitch (PC) {\n");
+	for (pc = 0; pc < length; pc++) {
+		fprintf(fptr, "\tcase %d: goto L_%d;\n", pc, pc);
+	}
+	fprintf(fptr, "\t}\n\n");
+
+	fprintf(fptr, "interpret:\n");
+	fprintf(fptr, "\taccount_quiet_cycles(sim, start - budget);\n\tsim->state.PC = PC;\n\n");
+	fprintf(fptr, "\tinst = begin_cycle(sim);\n\texecute_instruction(inst, &sim->state);\n\n");
+	fprintf(fptr, "\tif (end_cycle(sim)) {\n\t\treturn;\n\t}\n\n");
+	fprintf(fptr, "\tPC = sim->state.PC;\n\tbudget = start = quiet_cycles(sim);\n\tgoto dispatch;\n\n");
+
+	for (pc = 0; pc < length; pc++) {
+		write_instruction(fptr, &decoded[pc], pc, length);
+	}
+
+	fprintf(fptr, "\tPC = %d; goto dispatch;\n}\n", length & PC_MASK);
+
+	fclose(fptr);
+}
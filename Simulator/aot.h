@@ -0,0 +1,22 @@
+#ifndef __AOT_H__
+#define __AOT_H__
+
+#include "simulator.h"
+
+/*
+  description:
+	ahead of time translation of an assembled program to C.
+
+	Simulator.exe --translate imemin.txt program.c writes a C file with one label per instruction address. building it
+	together with the simulator sources and SIMP_AOT defined links its run_aot, selected at run time with --engine=aot.
+	translated code runs the quiet cycles and hands every other cycle to begin_cycle/end_cycle, like the JIT does.
+
+*/
+
+void translate_to_c(const char* imem, const decoded_instruction_t* decoded, char* c_fname);
+
+#ifdef SIMP_AOT
+void run_aot(simulator_t* sim);		// defined by the generated file.
+#endif
+
+#endif
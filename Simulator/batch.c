@@ -0,0 +1,464 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+
+#include "batch.h"
+#include "loader.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#include <direct.h>
+#else
+#include <pthread.h>
+#include <unistd.h>
+#include <time.h>
+#include <sys/stat.h>
+#endif
+
+typedef enum {
+	INPUT_IMEM,
+	INPUT_DMEM,
+	INPUT_IRQ2
+} input_kind_t;
+
+/*
+  description:
+	an input file read for the batch, with the fields of inputs that belong to its kind set.
+
+*/
+typedef struct {
+	input_kind_t kind;
+	char* fname;
+	simp_inputs_t inputs;
+} shared_input_t;
+
+typedef struct {
+	char* line;								// the manifest line, fields point into it.
+	char* fields[BATCH_FIELDS];
+	simp_config_t config;
+	simp_inputs_t inputs;
+	int64_t cycles;
+	double seconds;
+} batch_run_t;
+
+typedef struct {
+	batch_run_t* runs;
+	int num_of_runs;
+	volatile int32_t next_run;				// next run to hand out, taken by the workers with an atomic increment.
+
+	shared_input_t* shared;
+	int num_of_shared;
+	int num_of_references;
+} batch_t;
+
+#ifdef _WIN32
+static int32_t take_run(batch_t* batch) { return (int32_t)InterlockedIncrement((volatile LONG*)&batch->next_run) - 1; }
+#else
+static int32_t take_run(batch_t* batch) { return __atomic_fetch_add(&batch->next_run, 1, __ATOMIC_RELAXED); }
+#endif
+
+double now_seconds(void) {
+
+#ifdef _WIN32
+	LARGE_INTEGER counter, frequency;
+
+	QueryPerformanceCounter(&counter);
+	QueryPerformanceFrequency(&frequency);
+
+	return (double)counter.QuadPart / (double)frequency.QuadPart;
+#else
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	return (double)now.tv_sec + (double)now.tv_nsec * 1e-9;
+#endif
+}
+
+int available_cores(void) {
+
+#ifdef _WIN32
+	SYSTEM_INFO info;
+
+	GetSystemInfo(&info);
+	return (int)info.dwNumberOfProcessors;
+#else
+	long cores = sysconf(_SC_NPROCESSORS_ONLN);
+
+	return cores > 0 ? (int)cores : 1;
+#endif
+}
+
+void make_directory(char* path) {
+
+#ifdef _WIN32
+	int failed = _mkdir(path) != 0;
+#else
+	int failed = mkdir(path, 0777) != 0;
+#endif
+
+	if (failed && errno != EEXIST) {
+		printf("IO error encountered, can't create %s\nTerminating program...", path);
+		exit(-1);
+	}
+}
+
+/*
+  description:
+	outdir/name, or NULL for an output the options leave out.
+
+*/
+char* output_fname(const char* outdir, const char* name) {
+
+	size_t outdir_length = strlen(outdir);
+	size_t name_length;
+	char* fname;
+
+	if (name == NULL) {
+		return NULL;
+	}
+
+	name_length = strlen(name);
+	fname = calloc_and_check(outdir_length + name_length + 2, sizeof(char));
+
+	memcpy(fname, outdir, outdir_length);
+	if (outdir_length > 0 && outdir[outdir_length - 1] != '/' && outdir[outdir_length - 1] != '\\') {
+		fname[outdir_length++] = '/';
+	}
+	memcpy(fname + outdir_length, name, name_length);
+
+	return fname;
+}
+
+/*
+  description:
+	the shared copy of an input file, read the first time a run names it.
+
+*/
+static const simp_inputs_t* shared_input(batch_t* batch, input_kind_t kind, char* fname, engine_t engine) {
+
+	shared_input_t* shared;
+	int i;
+
+	batch->num_of_references++;
+
+	for (i = 0; i < batch->num_of_shared; i++) {
+
+		if (batch->shared[i].kind == kind && strcmp(batch->shared[i].fname, fname) == 0) {
+			return &batch->shared[i].inputs;
+		}
+	}
+
+	shared = &batch->shared[batch->num_of_shared++];
+	shared->kind = kind;
+	shared->fname = fname;
+
+	switch (kind) {
+
+	case INPUT_IMEM:
+
+		shared->inputs.imem = readfile(fname, IMEM_LINE_SIZE, MEM_SIZE);
+		shared->inputs.decoded_imem = predecode_imem(shared->inputs.imem, engine);
+		break;
+
+	case INPUT_DMEM:
+
+		shared->inputs.dmem = read_memory_image(fname, DMEM_LINE_SIZE, MEM_SIZE);
+		break;
+
+	case INPUT_IRQ2:
+
+		shared->inputs.irq2_up_clocks = readirq2(fname, &shared->inputs.num_irq2_up_clocks);
+		break;
+	}
+
+	return &shared->inputs;
+}
+
+/*
+  description:
+	splits line into its fields, separated by spaces or tabs, in place. returns the number of fields, max + 1 when
+	there are more than max, 0 for an empty line or one starting with '#'. the --bench suite is read with it too.
+
+*/
+int split_fields(char* line, char** fields, int max) {
+
+	int count = 0;
+	char* p = line;
+
+	for (;;) {
+
+		while (*p == ' ' || *p == '\t') p++;
+
+		if (*p == '\0' || *p == '\n' || *p == '\r' || (count == 0 && *p == '#')) {
+			return count;
+		}
+
+		if (count == max) {
+			return max + 1;
+		}
+
+		fields[count++] = p;
+
+		while (*p != '\0' && *p != ' ' && *p != '\t' && *p != '\n' && *p != '\r') p++;
+
+		if (*p == '\0') {
+			return count;
+		}
+
+		*p++ = '\0';
+	}
+}
+
+/*
+  description:
+	reads the manifest into runs, with their output directories created and shared inputs read.
+
+*/
+static void read_manifest(batch_t* batch, char* manifest_fname, const simp_config_t* options) {
+
+	FILE* fptr;
+	char line[BATCH_LINE_SIZE];
+	int capacity = 16;
+	int line_number = 0;
+
+	fopen_s(&fptr, manifest_fname, "r");
+
+	if (fptr == NULL) {
+		printf("IO error encountered\nTerminating program...");
+		exit(-1);
+	}
+
+	batch->runs = calloc_and_check(capacity, sizeof(batch_run_t));
+
+	while (fgets(line, sizeof(line), fptr) != NULL) {
+
+		size_t length = strlen(line);
+		batch_run_t* run;
+		char* outdir;
+		int count;
+
+		line_number++;
+
+		if (batch->num_of_runs == capacity) {
+
+			batch_run_t* temp_buffer = realloc(batch->runs, 2 * capacity * sizeof(batch_run_t));
+
+			if (temp_buffer == NULL) {
+				printf("Memory assignment error encountered\nTerminating program...");
+				exit(-1);
+			}
+
+			batch->runs = temp_buffer;
+			capacity *= 2;
+		}
+
+		run = &batch->runs[batch->num_of_runs];
+		memset(run, 0, sizeof(batch_run_t));
+
+		run->line = calloc_and_check(length + 1, sizeof(char));
+		memcpy(run->line, line, length);
+		count = split_fields(run->line, run->fields, BATCH_FIELDS);
+
+		if (count == 0) {
+			free(run->line);
+			continue;
+		}
+
+		if (count != BATCH_FIELDS) {
+			printf("Invalid batch manifest line %d, expected imemin dmemin diskin irq2in outdir\nTerminating program...", line_number);
+			exit(-1);
+		}
+
+		outdir = run->fields[4];
+		make_directory(outdir);
+
+		run->config = *options;
+		run->config.imemin = run->fields[0];
+		run->config.dmemin = run->fields[1];
+		run->config.diskin = run->fields[2];
+		run->config.irq2in = run->fields[3];
+		run->config.dmemout = output_fname(outdir, options->dmemout);
+		run->config.regout = output_fname(outdir, options->regout);
+		run->config.trace = output_fname(outdir, options->trace);
+		run->config.hwregtrace = output_fname(outdir, options->hwregtrace);
+		run->config.cycles = output_fname(outdir, options->cycles);
+		run->config.leds = output_fname(outdir, options->leds);
+		run->config.display7seg = output_fname(outdir, options->display7seg);
+		run->config.diskout = output_fname(outdir, options->diskout);
+		run->config.monitor = output_fname(outdir, options->monitor);
+		run->config.monitor_yuv = output_fname(outdir, options->monitor_yuv);
+		run->config.profile = output_fname(outdir, options->profile);
+		run->config.stacks = output_fname(outdir, options->stacks);
+		run->config.stats = output_fname(outdir, options->stats);
+
+		batch->num_of_runs++;
+	}
+
+	fclose(fptr);
+
+	batch->shared = calloc_and_check(3 * (size_t)batch->num_of_runs + 1, sizeof(shared_input_t));
+
+	for (int i = 0; i < batch->num_of_runs; i++) {
+
+		batch_run_t* run = &batch->runs[i];
+		const simp_inputs_t* imem = shared_input(batch, INPUT_IMEM, run->config.imemin, options->engine);
+		const simp_inputs_t* dmem = shared_input(batch, INPUT_DMEM, run->config.dmemin, options->engine);
+		const simp_inputs_t* irq2 = shared_input(batch, INPUT_IRQ2, run->config.irq2in, options->engine);
+
+		run->inputs.imem = imem->imem;
+		run->inputs.decoded_imem = imem->decoded_imem;
+		run->inputs.dmem = dmem->dmem;
+		run->inputs.irq2_up_clocks = irq2->irq2_up_clocks;
+		run->inputs.num_irq2_up_clocks = irq2->num_irq2_up_clocks;
+		run->config.inputs = &run->inputs;
+	}
+}
+
+static void run_one(batch_run_t* run) {
+
+	double start = now_seconds();
+	simp_machine_t* machine = simp_load(&run->config);
+
+	simp_run(machine, SIMP_NO_LIMIT);
+	simp_dump(machine);
+
+	run->cycles = machine->sim.clock;
+	simp_free(machine);
+	run->seconds = now_seconds() - start;
+}
+
+#ifdef _WIN32
+static DWORD WINAPI batch_worker(LPVOID argument) {
+#else
+static void* batch_worker(void* argument) {
+#endif
+
+	batch_t* batch = argument;
+	int32_t i;
+
+	while ((i = take_run(batch)) < batch->num_of_runs) {
+		run_one(&batch->runs[i]);
+	}
+
+	return 0;
+}
+
+static double throughput(int64_t cycles, double seconds) {
+
+	return seconds > 0 ? (double)cycles / seconds / 1e6 : 0;
+}
+
+static void print_report(const batch_t* batch, int jobs, double seconds) {
+
+	int64_t total_cycles = 0;
+	int i;
+
+	printf("%6s %14s %12s %12s  %s\n", "run", "cycles", "wall ms", "Mcycles/s", "outdir");
+
+	for (i = 0; i < batch->num_of_runs; i++) {
+
+		const batch_run_t* run = &batch->runs[i];
+
+		printf("%6d %14lld %12.3f %12.2f  %s\n", i + 1, (long long)run->cycles, run->seconds * 1e3, throughput(run->cycles, run->seconds), run->fields[4]);
+		total_cycles += run->cycles;
+	}
+
+	printf("%d runs on %d threads, %lld cycles in %.3f s: %.2f Mcycles/s, %.1f runs/s\n", batch->num_of_runs, jobs,
+		   (long long)total_cycles, seconds, throughput(total_cycles, seconds), seconds > 0 ? batch->num_of_runs / seconds : 0);
+	printf("%d imemin, dmemin and irq2in files read for %d uses\n", batch->num_of_shared, batch->num_of_references);
+}
+
+static void free_batch(batch_t* batch) {
+
+	int i;
+
+	for (i = 0; i < batch->num_of_shared; i++) {
+
+		free(batch->shared[i].inputs.imem);
+		free(batch->shared[i].inputs.decoded_imem);
+		free(batch->shared[i].inputs.dmem);
+		free(batch->shared[i].inputs.irq2_up_clocks);
+	}
+
+	for (i = 0; i < batch->num_of_runs; i++) {
+
+		simp_config_t* config = &batch->runs[i].config;
+
+		free(config->dmemout);
+		free(config->regout);
+		free(config->trace);
+		free(config->hwregtrace);
+		free(config->cycles);
+		free(config->leds);
+		free(config->display7seg);
+		free(config->diskout);
+		free(config->monitor);
+		free(config->monitor_yuv);
+		free(config->profile);
+		free(config->stacks);
+		free(config->stats);
+		free(batch->runs[i].line);
+	}
+
+	free(batch->shared);
+	free(batch->runs);
+}
+
+/*
+  description:
+	runs every run in the manifest with the given options, on jobs threads.
+
+*/
+void run_batch(char* manifest_fname, const simp_config_t* options, int jobs) {
+
+	batch_t batch;
+	simp_config_t settled = *options;
+	double start;
+	int i;
+
+	simp_check_config(&settled);      // warned about once, every run loads with the same options.
+
+	memset(&batch, 0, sizeof(batch));
+	read_manifest(&batch, manifest_fname, &settled);
+
+	if (jobs > batch.num_of_runs) jobs = batch.num_of_runs;
+	if (jobs < 1) jobs = 1;
+
+#ifdef _WIN32
+	HANDLE* threads = calloc_and_check(jobs, sizeof(HANDLE));
+#else
+	pthread_t* threads = calloc_and_check(jobs, sizeof(pthread_t));
+#endif
+
+	start = now_seconds();
+
+	for (i = 0; i < jobs; i++) {
+
+#ifdef _WIN32
+		threads[i] = CreateThread(NULL, 0, batch_worker, &batch, 0, NULL);
+		if (threads[i] == NULL) {
+#else
+		if (pthread_create(&threads[i], NULL, batch_worker, &batch) != 0) {
+#endif
+			printf("Thread creation error encountered\nTerminating program...");
+			exit(-1);
+		}
+	}
+
+	for (i = 0; i < jobs; i++) {
+
+#ifdef _WIN32
+		WaitForSingleObject(threads[i], INFINITE);
+		CloseHandle(threads[i]);
+#else
+		pthread_join(threads[i], NULL);
+#endif
+	}
+
+	print_report(&batch, jobs, now_seconds() - start);
+
+	free(threads);
+	free_batch(&batch);
+}
@@ -0,0 +1,36 @@
+#ifndef __BATCH_H__
+#define __BATCH_H__
+
+#include "simp.h"
+
+/*
+  description:
+	batch mode, Simulator --batch manifest.txt [options]: many runs in one process, on a pool of threads.
+
+	the manifest has a run per line, five names separated by spaces or tabs:
+
+	imemin dmemin diskin irq2in outdir
+
+	empty lines and lines starting with '#' are skipped. each run loads its own machine and writes its outputs into
+	outdir, created if it doesn't exist, under the names the command line uses in its examples (dmemout.txt,
+	trace.txt, ...). the options apply to every run, --profile, --stacks and --stats name files in
+	each outdir.
+
+	imemin, dmemin and irq2in files that appear in more than one run are read once, before the runs start, and
+	shared by their machines (see simp_inputs_t). diskin is mapped by each run, the mappings share the pages.
+
+	once every run finished, the cycles, wall time and throughput of each run are printed, then the totals.
+
+*/
+
+#define BATCH_FIELDS 5
+#define BATCH_LINE_SIZE 4096
+
+void run_batch(char* manifest_fname, const simp_config_t* options, int jobs);
+int available_cores(void);
+double now_seconds(void);
+void make_directory(char* path);
+char* output_fname(const char* outdir, const char* name);
+int split_fields(char* line, char** fields, int max);
+
+#endif
@@ -0,0 +1,573 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "bench.h"
+#include "batch.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#include <psapi.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#pragma comment(lib, "psapi.lib")
+#else
+#include <spawn.h>
+#include <sys/resource.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <fcntl.h>
+
+extern char** environ;
+#endif
+
+static const char engine_names[][9] = { "switch", "threaded", "jit", "aot" };
+
+typedef struct {
+	char* line;								// the suite line, fields point into it.
+	char* fields[BENCH_FIELDS];
+	char* program;							// program.asm, relative to the suite's directory.
+	char* outdir;
+	simp_config_t config;
+
+	int asm_lines;
+	double assemble_seconds;				// fastest of the repetitions, as are run_seconds.
+	int64_t cycles;
+	double run_seconds;
+	uint64_t output_bytes;
+} bench_workload_t;
+
+typedef struct {
+	bench_workload_t* workloads;
+	int num_of_workloads;
+} bench_t;
+
+static double rate(double amount, double seconds) {
+
+	return seconds > 0 ? amount / seconds : 0;
+}
+
+static uint64_t peak_rss_kb(void) {
+
+#ifdef _WIN32
+	PROCESS_MEMORY_COUNTERS counters;
+
+	if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+		return 0;
+	}
+
+	return (uint64_t)counters.PeakWorkingSetSize / 1024;
+#else
+	struct rusage usage;
+
+	if (getrusage(RUSAGE_SELF, &usage) != 0) {
+		return 0;
+	}
+
+#ifdef __APPLE__
+	return (uint64_t)usage.ru_maxrss / 1024;		// bytes on macOS, kilobytes elsewhere.
+#else
+	return (uint64_t)usage.ru_maxrss;
+#endif
+#endif
+}
+
+/*
+  description:
+	size of fname in bytes, 0 for an output the options leave out or that wasn't written.
+
+*/
+static uint64_t file_size(const char* fname) {
+
+#ifdef _WIN32
+	struct _stat64 info;
+
+	if (fname == NULL || _stat64(fname, &info) != 0) {
+		return 0;
+	}
+#else
+	struct stat info;
+
+	if (fname == NULL || stat(fname, &info) != 0) {
+		return 0;
+	}
+#endif
+
+	return (uint64_t)info.st_size;
+}
+
+static int count_lines(char* fname) {
+
+	FILE* fptr;
+	char buffer[BENCH_LINE_SIZE];
+	size_t length;
+	int lines = 0;
+	char last = '\n';
+
+	fopen_s(&fptr, fname, "rb");
+
+	if (fptr == NULL) {
+		printf("IO error encountered, can't read %s\nTerminating program...", fname);
+		exit(-1);
+	}
+
+	while ((length = fread(buffer, 1, sizeof(buffer), fptr)) > 0) {
+
+		for (size_t i = 0; i < length; i++) {
+			lines += buffer[i] == '\n';
+		}
+
+		last = buffer[length - 1];
+	}
+
+	fclose(fptr);
+
+	return lines + (last != '\n');      // a last line without a line break.
+}
+
+/*
+  description:
+	name as seen from the suite's directory: name itself when it is absolute or the suite is in the current one.
+
+*/
+static char* suite_relative(const char* suite_fname, const char* name) {
+
+	const char* end = suite_fname + strlen(suite_fname);
+	char* directory;
+	char* fname;
+
+	if (name[0] == '/' || name[0] == '\\' || (name[0] != '\0' && name[1] == ':')) {
+		return output_fname("", name);
+	}
+
+	while (end > suite_fname && end[-1] != '/' && end[-1] != '\\') end--;
+
+	directory = calloc_and_check(end - suite_fname + 1, sizeof(char));
+	memcpy(directory, suite_fname, end - suite_fname);
+	fname = output_fname(directory, name);
+	free(directory);
+
+	return fname;
+}
+
+/*
+  description:
+	reads the suite into workloads, with their output directories created.
+
+*/
+static void read_suite(bench_t* bench, char* suite_fname, char* outdir, const simp_config_t* options) {
+
+	FILE* fptr;
+	char line[BENCH_LINE_SIZE];
+	int capacity = 16;
+	int line_number = 0;
+
+	fopen_s(&fptr, suite_fname, "r");
+
+	if (fptr == NULL) {
+		printf("IO error encountered\nTerminating program...");
+		exit(-1);
+	}
+
+	bench->workloads = calloc_and_check(capacity, sizeof(bench_workload_t));
+
+	while (fgets(line, sizeof(line), fptr) != NULL) {
+
+		size_t length = strlen(line);
+		bench_workload_t* workload;
+		simp_config_t* config;
+		char* workload_dir;
+		int count;
+
+		line_number++;
+
+		if (bench->num_of_workloads == capacity) {
+
+			bench_workload_t* temp_buffer = realloc(bench->workloads, 2 * capacity * sizeof(bench_workload_t));
+
+			if (temp_buffer == NULL) {
+				printf("Memory assignment error encountered\nTerminating program...");
+				exit(-1);
+			}
+
+			bench->workloads = temp_buffer;
+			capacity *= 2;
+		}
+
+		workload = &bench->workloads[bench->num_of_workloads];
+		memset(workload, 0, sizeof(bench_workload_t));
+
+		workload->line = calloc_and_check(length + 1, sizeof(char));
+		memcpy(workload->line, line, length);
+		count = split_fields(workload->line, workload->fields, BENCH_FIELDS);
+
+		if (count == 0) {
+			free(workload->line);
+			continue;
+		}
+
+		if (count != BENCH_FIELDS) {
+			printf("Invalid benchmark suite line %d, expected name program.asm diskin irq2in\nTerminating program...", line_number);
+			exit(-1);
+		}
+
+		workload_dir = output_fname(outdir, workload->fields[0]);
+		make_directory(workload_dir);
+
+		workload->program = suite_relative(suite_fname, workload->fields[1]);
+		workload->outdir = workload_dir;
+
+		config = &workload->config;
+		*config = *options;
+		config->imemin = output_fname(workload_dir, "imemin.txt");
+		config->dmemin = output_fname(workload_dir, "dmemin.txt");
+		config->diskin = suite_relative(suite_fname, workload->fields[2]);
+		config->irq2in = suite_relative(suite_fname, workload->fields[3]);
+		config->dmemout = output_fname(workload_dir, options->dmemout);
+		config->regout = output_fname(workload_dir, options->regout);
+		config->trace = output_fname(workload_dir, options->trace);
+		config->hwregtrace = output_fname(workload_dir, options->hwregtrace);
+		config->cycles = output_fname(workload_dir, options->cycles);
+		config->leds = output_fname(workload_dir, options->leds);
+		config->display7seg = output_fname(workload_dir, options->display7seg);
+		config->diskout = output_fname(workload_dir, options->diskout);
+		config->monitor = output_fname(workload_dir, options->monitor);
+		config->monitor_yuv = output_fname(workload_dir, options->monitor_yuv);
+		config->profile = output_fname(workload_dir, options->profile);
+		config->symbols = options->profile != NULL ? output_fname(workload_dir, "symbols.txt") : NULL;
+		config->stacks = output_fname(workload_dir, options->stacks);
+		config->stats = output_fname(workload_dir, options->stats);
+
+		bench->num_of_workloads++;
+	}
+
+	fclose(fptr);
+}
+
+#ifdef _WIN32
+/*
+  description:
+	appends argument to the command line, quoted the way the C runtime of the program started splits it back.
+
+*/
+static char* quote_argument(char* end, const char* argument) {
+
+	int backslashes = 0;
+
+	*end++ = ' ';
+	*end++ = '"';
+
+	for (; *argument != '\0'; argument++) {
+
+		if (*argument == '\\') {
+			backslashes++;
+		}
+		else if (*argument == '"') {
+			for (backslashes++; backslashes > 0; backslashes--) *end++ = '\\';      // the ones before it doubled, plus one for it.
+		}
+		else {
+			backslashes = 0;
+		}
+
+		*end++ = *argument;
+	}
+
+	for (; backslashes > 0; backslashes--) *end++ = '\\';      // doubled, so that they don't escape the closing quote.
+
+	*end++ = '"';
+	*end = '\0';
+
+	return end;
+}
+
+/*
+  description:
+	runs argv[0], looked up as the command line's first name is, with stdout discarded and waits for it. returns
+	its exit code, -1 if it couldn't be started.
+
+*/
+static int spawn_and_wait(char* argv[]) {
+
+	SECURITY_ATTRIBUTES inherit = { sizeof(SECURITY_ATTRIBUTES), NULL, TRUE };
+	STARTUPINFOA startup;
+	PROCESS_INFORMATION process;
+	size_t size = 1;
+	char* command;
+	char* end;
+	DWORD code = (DWORD)-1;
+	int i;
+
+	for (i = 0; argv[i] != NULL; i++) {
+		size += 2 * strlen(argv[i]) + 3;
+	}
+
+	command = calloc_and_check(size, sizeof(char));
+	end = command;
+
+	for (i = 0; argv[i] != NULL; i++) {
+		end = quote_argument(end, argv[i]);
+	}
+
+	memset(&startup, 0, sizeof(startup));
+	startup.cb = sizeof(startup);
+	startup.dwFlags = STARTF_USESTDHANDLES;
+	startup.hStdInput = GetStdHandle(STD_INPUT_HANDLE);
+	startup.hStdOutput = CreateFileA("NUL", GENERIC_WRITE, FILE_SHARE_WRITE, &inherit, OPEN_EXISTING, 0, NULL);
+	startup.hStdError = GetStdHandle(STD_ERROR_HANDLE);
+
+	if (CreateProcessA(NULL, command + 1, NULL, NULL, TRUE, 0, NULL, NULL, &startup, &process)) {
+		WaitForSingleObject(process.hProcess, INFINITE);
+		GetExitCodeProcess(process.hProcess, &code);
+		CloseHandle(process.hThread);
+		CloseHandle(process.hProcess);
+	}
+
+	if (startup.hStdOutput != INVALID_HANDLE_VALUE) {
+		CloseHandle(startup.hStdOutput);
+	}
+
+	free(command);
+
+	return (int)code;
+}
+#else
+/*
+  description:
+	runs argv[0], looked up in PATH when it has no '/', with stdout discarded and waits for it. returns its exit
+	code, -1 if it couldn't be started or didn't exit.
+
+*/
+static int spawn_and_wait(char* argv[]) {
+
+	posix_spawn_file_actions_t actions;
+	pid_t pid;
+	int status;
+	int code = -1;
+
+	posix_spawn_file_actions_init(&actions);
+	posix_spawn_file_actions_addopen(&actions, 1, "/dev/null", O_WRONLY, 0);
+
+	if (posix_spawnp(&pid, argv[0], &actions, NULL, argv, environ) == 0 && waitpid(pid, &status, 0) == pid && WIFEXITED(status)) {
+		code = WEXITSTATUS(status);
+	}
+
+	posix_spawn_file_actions_destroy(&actions);
+
+	return code;
+}
+#endif
+
+/*
+  description:
+	runs the assembler on the workload's program, started directly rather than through a shell. returns its wall
+	time, from starting the process to its exit.
+
+*/
+static double assemble(const char* assembler, const bench_workload_t* workload) {
+
+	char* symbols = output_fname(workload->outdir, "symbols.txt");
+	char* argv[] = { (char*)assembler, workload->program, workload->config.imemin, workload->config.dmemin, symbols, NULL };
+	double seconds;
+	int status;
+
+	fflush(stdout);
+	seconds = now_seconds();
+	status = spawn_and_wait(argv);
+	seconds = now_seconds() - seconds;
+
+	if (status != 0) {
+		printf("Assembler failed on %s\nTerminating program...", workload->program);
+		exit(-1);
+	}
+
+	free(symbols);
+
+	return seconds;
+}
+
+static uint64_t output_bytes(const simp_config_t* config) {
+
+	return file_size(config->dmemout) + file_size(config->regout) + file_size(config->trace) + file_size(config->hwregtrace)
+		 + file_size(config->cycles) + file_size(config->leds) + file_size(config->display7seg) + file_size(config->diskout)
+		 + file_size(config->monitor) + file_size(config->monitor_yuv) + file_size(config->profile) + file_size(config->stacks)
+		 + file_size(config->stats);
+}
+
+static void run_workload(bench_workload_t* workload, const bench_options_t* bench) {
+
+	workload->asm_lines = count_lines(workload->program);
+
+	for (int i = 0; i < bench->repeat; i++) {
+
+		double assemble_seconds = assemble(bench->assembler, workload);
+		simp_machine_t* machine = simp_load(&workload->config);
+		double start = now_seconds();
+		double run_seconds;
+
+		simp_run(machine, SIMP_NO_LIMIT);
+		run_seconds = now_seconds() - start;
+		simp_dump(machine);
+
+		workload->cycles = machine->sim.clock;
+		simp_free(machine);
+
+		if (i == 0 || assemble_seconds < workload->assemble_seconds) workload->assemble_seconds = assemble_seconds;
+		if (i == 0 || run_seconds < workload->run_seconds) workload->run_seconds = run_seconds;
+	}
+
+	workload->output_bytes = output_bytes(&workload->config);
+}
+
+static void print_report(const bench_t* bench) {
+
+	int64_t total_cycles = 0;
+	double total_seconds = 0;
+	int i;
+
+	printf("%-12s %9s %14s %14s %10s %10s %14s\n", "workload", "asm lines", "asm lines/s", "cycles", "run ms", "MIPS", "output bytes");
+
+	for (i = 0; i < bench->num_of_workloads; i++) {
+
+		const bench_workload_t* workload = &bench->workloads[i];
+
+		printf("%-12s %9d %14.0f %14lld %10.3f %10.2f %14llu\n", workload->fields[0], workload->asm_lines,
+			   rate(workload->asm_lines, workload->assemble_seconds), (long long)workload->cycles, workload->run_seconds * 1e3,
+			   rate((double)workload->cycles, workload->run_seconds) / 1e6, (unsigned long long)workload->output_bytes);
+
+		total_cycles += workload->cycles;
+		total_seconds += workload->run_seconds;
+	}
+
+	printf("%d workloads, %lld cycles in %.3f s: %.2f MIPS, peak RSS %llu KB\n", bench->num_of_workloads, (long long)total_cycles,
+		   total_seconds, rate((double)total_cycles, total_seconds) / 1e6, (unsigned long long)peak_rss_kb());
+}
+
+static void write_json_string(FILE* fptr, const char* string) {
+
+	fputc('"', fptr);
+
+	for (; *string != '\0'; string++) {
+
+		if (*string == '"' || *string == '\\') {
+			fputc('\\', fptr);
+		}
+
+		fputc(*string, fptr);
+	}
+
+	fputc('"', fptr);
+}
+
+/*
+  description:
+	writes the report to outdir/results.json, every field present for every workload.
+
+*/
+static void write_results(const bench_t* bench, char* suite_fname, char* outdir, const simp_config_t* settled, const bench_options_t* options) {
+
+	char* fname = output_fname(outdir, BENCH_RESULTS);
+	int64_t total_cycles = 0;
+	double total_seconds = 0;
+	FILE* fptr;
+	int i;
+
+	fopen_s(&fptr, fname, "w");
+
+	if (fptr == NULL) {
+		printf("IO error encountered\nTerminating program...");
+		exit(-1);
+	}
+
+	fprintf(fptr, "{\n  \"format\": \"%s\",\n  \"suite\": ", BENCH_FORMAT);
+	write_json_string(fptr, suite_fname);
+	fprintf(fptr, ",\n  \"engine\": \"%s\",\n", engine_names[settled->engine]);
+	fprintf(fptr, "  \"trace\": %s,\n  \"binary_trace\": %s,\n  \"async_output\": %s,\n  \"fast_forward\": %s,\n",
+			settled->trace != NULL ? "true" : "false", settled->trace_binary ? "true" : "false",
+			settled->async_output ? "true" : "false", settled->fast_forward ? "true" : "false");
+	fprintf(fptr, "  \"cores\": %d,\n  \"repeat\": %d,\n  \"workloads\": [\n", settled->cores, options->repeat);
+
+	for (i = 0; i < bench->num_of_workloads; i++) {
+
+		const bench_workload_t* workload = &bench->workloads[i];
+
+		fprintf(fptr, "    {\"name\": ");
+		write_json_string(fptr, workload->fields[0]);
+		fprintf(fptr, ", \"asm_lines\": %d, \"assemble_seconds\": %.6f, \"assembler_lines_per_second\": %.1f, ",
+				workload->asm_lines, workload->assemble_seconds, rate(workload->asm_lines, workload->assemble_seconds));
+		fprintf(fptr, "\"cycles\": %lld, \"run_seconds\": %.6f, \"mips\": %.3f, \"output_bytes\": %llu}%s\n",
+				(long long)workload->cycles, workload->run_seconds, rate((double)workload->cycles, workload->run_seconds) / 1e6,
+				(unsigned long long)workload->output_bytes, i + 1 < bench->num_of_workloads ? "," : "");
+
+		total_cycles += workload->cycles;
+		total_seconds += workload->run_seconds;
+	}
+
+	fprintf(fptr, "  ],\n  \"totals\": {\"cycles\": %lld, \"run_seconds\": %.6f, \"mips\": %.3f, \"peak_rss_kb\": %llu}\n}\n",
+			(long long)total_cycles, total_seconds, rate((double)total_cycles, total_seconds) / 1e6, (unsigned long long)peak_rss_kb());
+
+	fclose(fptr);
+	free(fname);
+}
+
+static void free_bench(bench_t* bench) {
+
+	int i;
+
+	for (i = 0; i < bench->num_of_workloads; i++) {
+
+		bench_workload_t* workload = &bench->workloads[i];
+		simp_config_t* config = &workload->config;
+
+		free(config->imemin);
+		free(config->dmemin);
+		free(config->diskin);
+		free(config->irq2in);
+		free(config->dmemout);
+		free(config->regout);
+		free(config->trace);
+		free(config->hwregtrace);
+		free(config->cycles);
+		free(config->leds);
+		free(config->display7seg);
+		free(config->diskout);
+		free(config->monitor);
+		free(config->monitor_yuv);
+		free(config->profile);
+		free(config->symbols);
+		free(config->stacks);
+		free(config->stats);
+		free(workload->program);
+		free(workload->outdir);
+		free(workload->line);
+	}
+
+	free(bench->workloads);
+}
+
+/*
+  description:
+	assembles and runs every workload of the suite with the given options, writing their outputs and the report
+	under outdir.
+
+*/
+void run_bench(char* suite_fname, char* outdir, const simp_config_t* options, const bench_options_t* bench_options) {
+
+	bench_t bench;
+	simp_config_t settled = *options;
+	int i;
+
+	simp_check_config(&settled);      // warned about once, every workload loads with the same options.
+
+	make_directory(outdir);
+	memset(&bench, 0, sizeof(bench));
+	read_suite(&bench, suite_fname, outdir, &settled);
+
+	for (i = 0; i < bench.num_of_workloads; i++) {
+		run_workload(&bench.workloads[i], bench_options);
+	}
+
+	print_report(&bench);
+	write_results(&bench, suite_fname, outdir, &settled, bench_options);
+
+	free_bench(&bench);
+}
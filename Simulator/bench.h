@@ -0,0 +1,52 @@
+#ifndef __BENCH_H__
+#define __BENCH_H__
+
+#include "simp.h"
+
+/*
+  description:
+	benchmark mode, Simulator --bench suite.txt outdir --assembler=PATH [options]: assembles and runs each workload of
+	a suite, one after the other in this process, and reports how fast both went. Programs/bench/suite.txt is the
+	suite of the repo, a workload per kind of code the simulator spends its time on, and unrolled, a program that fills
+	imem so that there is something to measure the assembler on.
+
+	the suite has a workload per line, four names separated by spaces or tabs:
+
+	name program.asm diskin irq2in
+
+	empty lines and lines starting with '#' are skipped, relative names are relative to the suite's directory. each
+	workload is assembled into outdir/name/imemin.txt, dmemin.txt and symbols.txt by running the assembler, started
+	directly rather than through a shell, then loaded and run with the options, its outputs written into outdir/name
+	under the names --batch uses. with --profile the workload's symbols name the report.
+
+	for each workload the report gives:
+
+	asm_lines                    lines of program.asm
+	assembler_lines_per_second   asm_lines over the assembler's wall time from process start to exit. starting the
+	                             process dominates a program of a few dozen lines, compare the rate on unrolled
+	cycles                       simulated cycles, one instruction per cycle
+	mips                         cycles over the wall time of simp_run, loading and dumping left out
+	output_bytes                 total size of the output files the workload wrote
+
+	the totals add up the cycles and run times and give peak_rss_kb, the peak resident set of the process over the
+	whole suite. the workloads share the process, so the peak isn't broken down by workload.
+
+	--repeat=N runs each workload N times and keeps the fastest assembly and the fastest run. the table is printed,
+	and outdir/results.json gets the same numbers in a fixed layout: the same keys in the same order for every
+	build, "format" changing whenever they do, so that results files of two builds can be compared directly.
+
+*/
+
+#define BENCH_FIELDS 4
+#define BENCH_LINE_SIZE 4096
+#define BENCH_FORMAT "simp-bench-2"
+#define BENCH_RESULTS "results.json"
+
+typedef struct {
+	char* assembler;						// assembler executable, run once per workload and repetition.
+	int repeat;								// runs of each workload, the fastest one reported.
+} bench_options_t;
+
+void run_bench(char* suite_fname, char* outdir, const simp_config_t* options, const bench_options_t* bench);
+
+#endif
@@ -0,0 +1,351 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <signal.h>
+
+#include "checkpoint.h"
+#include "output.h"
+#include "loader.h"
+#include "log.h"
+#include "../Common/hex.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+#if defined(SIGUSR1)
+#define CHECKPOINT_SIGNAL SIGUSR1
+#elif defined(SIGBREAK)
+#define CHECKPOINT_SIGNAL SIGBREAK
+#endif
+
+static volatile sig_atomic_t checkpoint_requested = 0;
+
+#ifdef CHECKPOINT_SIGNAL
+static void request_checkpoint(int signal_number) {
+
+	checkpoint_requested = 1;
+	signal(signal_number, request_checkpoint);
+}
+#endif
+
+static void put_u32(char* p, uint32_t value) {
+
+	p[0] = (char)(value & 0xFF);
+	p[1] = (char)((value >> 8) & 0xFF);
+	p[2] = (char)((value >> 16) & 0xFF);
+	p[3] = (char)((value >> 24) & 0xFF);
+}
+
+static void write_u32(writer_t* writer, uint32_t value) {
+
+	put_u32(writer_reserve(writer, 4), value);
+}
+
+static void write_u64(writer_t* writer, uint64_t value) {
+
+	write_u32(writer, (uint32_t)value);
+	write_u32(writer, (uint32_t)(value >> 32));
+}
+
+static void write_words(writer_t* writer, const void* words, int count) {
+
+	const uint32_t* p = words;
+	int i;
+
+	for (i = 0; i < count; i++) {
+		write_u32(writer, p[i]);
+	}
+}
+
+/*
+  description:
+	reading side: a cursor over the mapped checkpoint. running past its end means the file isn't a whole checkpoint.
+
+*/
+typedef struct {
+	const unsigned char* p;
+	const unsigned char* end;
+} reader_t;
+
+static void invalid_checkpoint(void) {
+
+	printf("Invalid checkpoint file\nTerminating program...");
+	exit(-1);
+}
+
+static const unsigned char* read_bytes(reader_t* reader, size_t size) {
+
+	const unsigned char* p = reader->p;
+
+	if ((size_t)(reader->end - reader->p) < size) {
+		invalid_checkpoint();
+	}
+
+	reader->p += size;
+	return p;
+}
+
+static uint32_t read_u32(reader_t* reader) {
+
+	const unsigned char* p = read_bytes(reader, 4);
+
+	return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static uint64_t read_u64(reader_t* reader) {
+
+	uint64_t low = read_u32(reader);
+
+	return low | ((uint64_t)read_u32(reader) << 32);
+}
+
+static void read_words(reader_t* reader, void* words, int count) {
+
+	uint32_t* p = words;
+	int i;
+
+	for (i = 0; i < count; i++) {
+		p[i] = read_u32(reader);
+	}
+}
+
+/*
+  description:
+	sets up --checkpoint once the starting clock is known, after a restore.
+
+*/
+void checkpoint_init(simulator_t* sim) {
+
+	if (sim->checkpoint_fname == NULL) {
+		return;
+	}
+
+	if (sim->checkpoint_every > 0) {
+		sim->next_checkpoint = ((int64_t)sim->clock / sim->checkpoint_every + 1) * sim->checkpoint_every;
+	}
+
+#ifdef CHECKPOINT_SIGNAL
+	signal(CHECKPOINT_SIGNAL, request_checkpoint);
+#endif
+}
+
+/*
+  description:
+	schedules the next periodic checkpoint. when a request can come in by signal, it is looked for at least every
+	CHECKPOINT_POLL_CYCLES cycles, which is as close as the engines can check without a per cycle test.
+
+*/
+void schedule_checkpoint(simulator_t* sim) {
+
+	int64_t clock = NEVER;
+
+	if (sim->checkpoint_fname == NULL) {
+		return;
+	}
+
+	if (sim->checkpoint_every > 0) {
+		clock = sim->next_checkpoint;
+	}
+
+#ifdef CHECKPOINT_SIGNAL
+	if (clock - sim->clock > CHECKPOINT_POLL_CYCLES) {
+		clock = (int64_t)sim->clock + CHECKPOINT_POLL_CYCLES;
+	}
+#endif
+
+	schedule_event(&sim->events, EVENT_CHECKPOINT, clock);
+}
+
+void checkpoint_event(simulator_t* sim) {
+
+	if ((sim->checkpoint_every > 0 && sim->clock >= sim->next_checkpoint) || checkpoint_requested) {
+
+		checkpoint_requested = 0;
+		write_checkpoint(sim, sim->checkpoint_fname);
+		LOG_INFO("Checkpoint written at clock %lld\n", (long long)sim->clock);
+
+		if (sim->checkpoint_every > 0) {
+			sim->next_checkpoint = ((int64_t)sim->clock / sim->checkpoint_every + 1) * sim->checkpoint_every;
+		}
+	}
+
+	schedule_checkpoint(sim);
+}
+
+static void replace_file(char* temp_fname, char* p_fname) {
+
+#ifdef _WIN32
+	int failed = !MoveFileExA(temp_fname, p_fname, MOVEFILE_REPLACE_EXISTING);
+#else
+	int failed = rename(temp_fname, p_fname) != 0;
+#endif
+
+	if (failed) {
+		printf("IO error encountered\nTerminating program...");
+		exit(-1);
+	}
+}
+
+/*
+  description:
+	writes the state at the start of the current cycle. the output files are brought up to date first, with the
+	async output pipeline drained and restarted around it.
+
+*/
+void write_checkpoint(simulator_t* sim, char* p_fname) {
+
+	machine_state_t* state = &sim->state;
+	size_t name_length = strlen(p_fname);
+	char* temp_fname = calloc_and_check(name_length + 5, sizeof(char));
+	writer_t* writer;
+	int64_t offsets[4];
+	uint32_t dirty_sectors = 0;
+	int sector, i;
+
+	memcpy(temp_fname, p_fname, name_length);
+	memcpy(temp_fname + name_length, ".tmp", 4);
+
+	if (sim->output != NULL) {
+		output_stop(sim->output);
+	}
+
+	offsets[0] = sim->trace != NULL ? writer_offset(sim->trace) : -1;
+	offsets[1] = event_log_offset(&sim->hwregtrace_log);
+	offsets[2] = event_log_offset(&sim->leds_log);
+	offsets[3] = event_log_offset(&sim->display7seg_log);
+
+	if (sim->output != NULL) {
+		sim->output = output_start(sim);
+	}
+
+	writer = writer_open(temp_fname, WRITER_BUFFER_SIZE, 1);
+	writer_write(writer, CHECKPOINT_MAGIC, CHECKPOINT_MAGIC_SIZE);
+
+	write_u64(writer, (uint64_t)sim->clock);
+	write_u32(writer, state->PC);
+	write_u32(writer, (state->irq_subroutine_flag ? 1 : 0) | (state->halt_flag ? 2 : 0));
+	write_words(writer, state->R, NUM_OF_REGISTERS);
+	write_words(writer, state->IO, NUM_OF_IO_REGISTERS);
+
+	write_u32(writer, (uint32_t)sim->disk_read_end);
+	write_u32(writer, (uint32_t)sim->irq2_up_clocks_index);
+	write_u32(writer, (uint32_t)sim->leds);
+	write_u32(writer, (uint32_t)sim->display7seg);
+
+	write_u32(writer, (sim->trace_enabled ? 1 : 0) | (sim->trace_binary ? 2 : 0));
+	write_words(writer, sim->trace_previous, NUM_OF_REGISTERS);
+
+	for (i = 0; i < 4; i++) {
+		write_u64(writer, (uint64_t)offsets[i]);
+	}
+
+	write_words(writer, state->dmem, MEM_SIZE);
+	writer_write(writer, sim->monitor_hex, MONITOR_PIXELS);
+
+	for (sector = 0; sector < sim->disk->num_of_sectors; sector++) {
+		dirty_sectors += sim->disk->dirty[sector];
+	}
+
+	write_u32(writer, (uint32_t)sim->disk->num_of_sectors);
+	write_u32(writer, dirty_sectors);
+
+	for (sector = 0; sector < sim->disk->num_of_sectors; sector++) {
+
+		if (sim->disk->dirty[sector]) {
+
+			write_u32(writer, (uint32_t)sector);
+			write_words(writer, sim->disk->sectors[sector], SECTOR_SIZE);
+		}
+	}
+
+	writer_close(writer);
+	replace_file(temp_fname, p_fname);
+	free(temp_fname);
+}
+
+/*
+  description:
+	replaces the state loaded from the input files with the checkpoint's, and reopens the trace and the logs where
+	it left them. called before the outputs are started, with the same input files and options as the checkpointed run.
+
+*/
+void restore_checkpoint(simulator_t* sim, char* p_fname, char* trace_fname) {
+
+	machine_state_t* state = &sim->state;
+	mapped_file_t file;
+	reader_t reader;
+	uint32_t flags, options, dirty_sectors, i;
+	int64_t offsets[4];
+	int pixel;
+
+	map_file(p_fname, &file);
+	reader.p = (const unsigned char*)file.data;
+	reader.end = reader.p + file.size;
+
+	if (memcmp(read_bytes(&reader, CHECKPOINT_MAGIC_SIZE), CHECKPOINT_MAGIC, CHECKPOINT_MAGIC_SIZE) != 0) {
+		invalid_checkpoint();
+	}
+
+	sim->clock = (int64_t)read_u64(&reader);
+	state->PC = read_u32(&reader) & PC_MASK;
+	flags = read_u32(&reader);
+	state->irq_subroutine_flag = (flags & 1) != 0;
+	state->halt_flag = (flags & 2) != 0;
+	read_words(&reader, state->R, NUM_OF_REGISTERS);
+	read_words(&reader, state->IO, NUM_OF_IO_REGISTERS);
+
+	sim->disk_read_end = (int32_t)read_u32(&reader);
+	sim->irq2_up_clocks_index = (int)read_u32(&reader);
+	sim->leds = (int32_t)read_u32(&reader);
+	sim->display7seg = (int32_t)read_u32(&reader);
+
+	options = read_u32(&reader);
+	read_words(&reader, sim->trace_previous, NUM_OF_REGISTERS);
+
+	for (i = 0; i < 4; i++) {
+		offsets[i] = (int64_t)read_u64(&reader);
+	}
+
+	if (options != (uint32_t)((sim->trace_enabled ? 1 : 0) | (sim->trace_binary ? 2 : 0))) {
+		printf("The checkpoint was taken with different trace options\nTerminating program...");
+		exit(-1);
+	}
+
+	read_words(&reader, state->dmem, MEM_SIZE);
+	memcpy(sim->monitor_hex, read_bytes(&reader, MONITOR_PIXELS), MONITOR_PIXELS);
+
+	for (pixel = 0; pixel < MONITOR_PIXELS; pixel++) {
+		hex_format(sim->monitor + pixel * (MONITOR_LINE_SIZE + 1), (uint8_t)sim->monitor_hex[pixel], MONITOR_LINE_SIZE, 1);
+	}
+
+	if (read_u32(&reader) != (uint32_t)sim->disk->num_of_sectors) {
+		printf("The checkpoint was taken with a different --disk-sectors\nTerminating program...");
+		exit(-1);
+	}
+
+	dirty_sectors = read_u32(&reader);
+
+	for (i = 0; i < dirty_sectors; i++) {
+
+		uint32_t words[SECTOR_SIZE];
+		uint32_t sector = read_u32(&reader);
+
+		if (sector >= (uint32_t)sim->disk->num_of_sectors) {
+			invalid_checkpoint();
+		}
+
+		read_words(&reader, words, SECTOR_SIZE);
+		disk_write(sim->disk, (int)sector, words);
+	}
+
+	unmap_file(&file);
+
+	if (sim->trace_enabled) {
+		sim->trace = writer_resume(trace_fname, WRITER_BUFFER_SIZE, sim->trace_binary, offsets[0]);
+	}
+
+	event_log_resume(&sim->hwregtrace_log, sim->hwregtrace_log.fname, offsets[1]);
+	event_log_resume(&sim->leds_log, sim->leds_log.fname, offsets[2]);
+	event_log_resume(&sim->display7seg_log, sim->display7seg_log.fname, offsets[3]);
+}
@@ -0,0 +1,41 @@
+#ifndef __CHECKPOINT_H__
+#define __CHECKPOINT_H__
+
+#include "simulator.h"
+
+/*
+  description:
+	machine checkpoints, written with --checkpoint=file every --checkpoint-every cycles and on request (SIGUSR1,
+	or Ctrl+Break on Windows), and resumed with --restore=file.
+
+	a checkpoint is taken at the start of a cycle, before anything due in it is serviced: it is the checkpoint event,
+	first in kind order. the scheduled events themselves aren't saved, they follow from the state as at startup.
+	each checkpoint replaces the previous one through a temporary file, so a crash never leaves half of one.
+
+	file layout, all integers little endian:
+	header      - "SIMPCKP3"
+	machine     - u64 clock, u32 PC, u32 flags (bit 0 irq subroutine, bit 1 halt), i32 R[16], i32 IO[33]
+	peripherals - i32 disk read end, u32 irq2in cursor, i32 leds, i32 display7seg
+	trace       - u32 options (bit 0 trace, bit 1 binary trace), i32 registers of the last binary trace record[16]
+	outputs     - i64 size of trace, hwregtrace, leds and display7seg, -1 for a log that wasn't created yet
+	dmem        - MEM_SIZE u32
+	monitor     - MONITOR_PIXELS bytes as in monitor.yuv, monitor.txt is their hex
+	disk        - u32 sectors, u32 dirty sectors, then u32 sector and SECTOR_SIZE u32 words for each dirty sector.
+	              clean sectors are read from diskin again, which must be the same file.
+
+	a run resumed from a checkpoint takes the same input files and options, and carries on writing its outputs
+	from where the checkpoint left them.
+
+*/
+
+#define CHECKPOINT_MAGIC "SIMPCKP3"
+#define CHECKPOINT_MAGIC_SIZE 8
+#define CHECKPOINT_POLL_CYCLES (1 << 20)		// how often a checkpoint request is looked for.
+
+void checkpoint_init(simulator_t* sim);
+void schedule_checkpoint(simulator_t* sim);
+void checkpoint_event(simulator_t* sim);
+void write_checkpoint(simulator_t* sim, char* p_fname);
+void restore_checkpoint(simulator_t* sim, char* p_fname, char* trace_fname);
+
+#endif
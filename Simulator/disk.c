@@ -0,0 +1,222 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "disk.h"
+#include "simulator.h"
+#include "../Common/hex.h"
+
+static const char* image_end(const disk_t* disk) {
+
+	return disk->image.data + disk->image.size;
+}
+
+void disk_open(disk_t* disk, char* p_fname, int num_of_sectors) {
+
+	map_file(p_fname, &disk->image);
+
+	disk->num_of_sectors = num_of_sectors;
+	disk->sectors = calloc_and_check(num_of_sectors, sizeof(uint32_t*));
+	disk->dirty = calloc_and_check(num_of_sectors, sizeof(uint8_t));
+	disk->sector_text = calloc_and_check(num_of_sectors, sizeof(const char*));
+
+	disk->sector_text[0] = disk->image.data;
+	disk->indexed_sectors = 1;
+}
+
+/*
+  description:
+	start of the sector's lines in diskin, found by skipping whole sectors of lines from the last one known.
+	sectors past the end of diskin start at its end or at the empty line that ends it.
+
+*/
+static const char* sector_text(disk_t* disk, int sector) {
+
+	while (disk->indexed_sectors <= sector) {
+
+		disk->sector_text[disk->indexed_sectors] = skip_lines(disk->sector_text[disk->indexed_sectors - 1], image_end(disk), SECTOR_SIZE);
+		disk->indexed_sectors++;
+	}
+
+	return disk->sector_text[sector];
+}
+
+/*
+  description:
+	the sector's words, parsed from diskin the first time. parsing a sector also finds where the next one starts.
+
+*/
+static uint32_t* load_sector(disk_t* disk, int sector) {
+
+	if (disk->sectors[sector] == NULL) {
+
+		const char* next;
+
+		disk->sectors[sector] = calloc_and_check(SECTOR_SIZE, sizeof(uint32_t));
+		next = parse_memory_lines(disk->sectors[sector], SECTOR_SIZE, DISK_LINE_SIZE, sector_text(disk, sector), image_end(disk));
+
+		if (sector + 1 == disk->indexed_sectors && sector + 1 < disk->num_of_sectors) {
+
+			disk->sector_text[sector + 1] = next;
+			disk->indexed_sectors++;
+		}
+	}
+
+	return disk->sectors[sector];
+}
+
+void disk_read(disk_t* disk, int sector, uint32_t* buffer) {
+
+	memcpy(buffer, load_sector(disk, sector), SECTOR_SIZE * sizeof(uint32_t));
+}
+
+/*
+  description:
+	a write replaces the whole sector, so it never needs parsing.
+
+*/
+void disk_write(disk_t* disk, int sector, const uint32_t* buffer) {
+
+	if (disk->sectors[sector] == NULL) {
+		disk->sectors[sector] = calloc_and_check(SECTOR_SIZE, sizeof(uint32_t));
+	}
+
+	memcpy(disk->sectors[sector], buffer, SECTOR_SIZE * sizeof(uint32_t));
+	disk->dirty[sector] = 1;
+}
+
+/*
+  description:
+	parses every sector and unmaps diskin, for when diskout is written over it.
+
+*/
+void disk_load_all(disk_t* disk) {
+
+	int sector;
+
+	for (sector = 0; sector < disk->num_of_sectors; sector++) {
+		load_sector(disk, sector);
+	}
+
+	unmap_file(&disk->image);
+
+	memset(disk->sector_text, 0, disk->num_of_sectors * sizeof(const char*));
+	disk->indexed_sectors = disk->num_of_sectors;
+}
+
+/*
+  description:
+	the characters diskout lines are made of, besides '\n'.
+
+*/
+static const uint8_t output_digit[256] = {
+	['0'] = 1, ['1'] = 1, ['2'] = 1, ['3'] = 1, ['4'] = 1, ['5'] = 1, ['6'] = 1, ['7'] = 1, ['8'] = 1, ['9'] = 1,
+	['A'] = 1, ['B'] = 1, ['C'] = 1, ['D'] = 1, ['E'] = 1, ['F'] = 1
+};
+
+/*
+  description:
+	whether the length bytes at text are already in the diskout format: lines of 8 uppercase hex digits separated
+	by '\n'. the digits of a line are checked together, a branch per character mispredicts on random data.
+
+*/
+static int formatted_text(const char* text, const char* end, size_t length) {
+
+	size_t line;
+
+	if (text == NULL || (size_t)(end - text) < length) {
+		return 0;
+	}
+
+	for (line = 0; line < length; line += 9) {
+
+		const uint8_t* c = (const uint8_t*)text + line;
+		int digits = output_digit[c[0]] & output_digit[c[1]] & output_digit[c[2]] & output_digit[c[3]] &
+					 output_digit[c[4]] & output_digit[c[5]] & output_digit[c[6]] & output_digit[c[7]];
+
+		if (!digits || (line + 8 < length && c[8] != '\n')) {
+			return 0;
+		}
+	}
+
+	return 1;
+}
+
+/*
+  description:
+	writes diskout, num_of_sectors * SECTOR_SIZE lines with no newline after the last. runs of clean, formatted
+	sectors are passed straight from the mapped diskin to the file.
+
+*/
+void disk_write_image(disk_t* disk, char* p_fname) {
+
+	writer_t* out = writer_open(p_fname, WRITER_BUFFER_SIZE, 0);
+	const char* run = NULL;					// clean input text not written yet.
+	size_t run_length = 0;
+	uint32_t parsed[SECTOR_SIZE];
+	char text[SECTOR_TEXT_SIZE];
+	int sector;
+
+	memset(text, '\n', sizeof(text));
+
+	for (sector = 0; sector < disk->num_of_sectors; sector++) {
+
+		size_t length = sector == disk->num_of_sectors - 1 ? SECTOR_TEXT_SIZE - 1 : SECTOR_TEXT_SIZE;
+		const uint32_t* words = disk->sectors[sector];
+
+		if (!disk->dirty[sector]) {
+
+			const char* input = sector_text(disk, sector);
+
+			if (formatted_text(input, image_end(disk), length)) {
+
+				if (run + run_length != input) {
+
+					if (run_length != 0) writer_write(out, run, run_length);
+
+					run = input;
+					run_length = 0;
+				}
+
+				run_length += length;
+				continue;
+			}
+
+			if (words == NULL) {
+
+				memset(parsed, 0, sizeof(parsed));
+				parse_memory_lines(parsed, SECTOR_SIZE, DISK_LINE_SIZE, input, image_end(disk));
+				words = parsed;
+			}
+		}
+
+		if (run_length != 0) {
+
+			writer_write(out, run, run_length);
+			run_length = 0;
+		}
+
+		hex_encode_words(text, words, SECTOR_SIZE, 9, 1);
+		writer_write(out, text, length);
+	}
+
+	if (run_length != 0) {
+		writer_write(out, run, run_length);
+	}
+
+	writer_close(out);
+}
+
+void disk_close(disk_t* disk) {
+
+	int sector;
+
+	for (sector = 0; sector < disk->num_of_sectors; sector++) {
+		free(disk->sectors[sector]);
+	}
+
+	free(disk->sectors);
+	free(disk->dirty);
+	free(disk->sector_text);
+	unmap_file(&disk->image);
+}
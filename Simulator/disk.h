@@ -0,0 +1,39 @@
+#ifndef __DISK_H__
+#define __DISK_H__
+
+#include <stdint.h>
+
+#include "loader.h"
+
+#define DISK_SECTORS 128							// default number of sectors, --disk-sectors changes it.
+#define DISK_MAX_SECTORS (1 << 20)
+#define SECTOR_TEXT_SIZE (SECTOR_SIZE * 9)			// a sector of diskin/diskout lines, 8 digits and '\n' each.
+
+/*
+  description:
+	the disk as a sector table over the mapped diskin. a sector is parsed the first time a disk command transfers
+	it and kept from then on, a sector that is never transferred is never parsed. sectors written by the program
+	are marked dirty.
+
+	diskout streams diskin through: clean sectors whose lines are already in the output format are copied as they
+	are, dirty sectors and sectors in any other format are formatted from their words. so nothing is proportional to
+	the disk size but the sector table and the output itself.
+
+*/
+typedef struct {
+	mapped_file_t image;				// diskin, mapped for the whole run.
+	int num_of_sectors;
+	uint32_t** sectors;					// NULL until the sector is first transferred.
+	uint8_t* dirty;
+	const char** sector_text;			// where each sector's lines start in diskin, found on demand.
+	int indexed_sectors;				// sector_text is known for the sectors below this.
+} disk_t;
+
+void disk_open(disk_t* disk, char* p_fname, int num_of_sectors);
+void disk_read(disk_t* disk, int sector, uint32_t* buffer);
+void disk_write(disk_t* disk, int sector, const uint32_t* buffer);
+void disk_load_all(disk_t* disk);
+void disk_write_image(disk_t* disk, char* p_fname);
+void disk_close(disk_t* disk);
+
+#endif
@@ -0,0 +1,139 @@
+#include <string.h>
+
+#include "idle.h"
+
+/*
+  description:
+	one recorded cycle of an idle loop pass: what the trace row and hwregtrace show for it.
+
+*/
+typedef struct {
+	uint32_t PC;
+	int32_t R[NUM_OF_REGISTERS];
+	int hw_info[3];
+} idle_cycle_t;
+
+/*
+  description:
+	whether inst may be part of a skipped loop. it must change nothing but registers, print no warning and not read
+	an io register that changes every cycle.
+
+*/
+static int idle_instruction(const decoded_instruction_t* inst, const int32_t R[NUM_OF_REGISTERS]) {
+
+	int32_t index = R[inst->rs] + R[inst->rt];
+
+	switch (inst->opcode) {
+
+	case 9: case 10: case 11: case 12: case 13: case 14:		// branches
+		return 1;
+
+	case 16:													// lw
+		return index >= 0 && index < MEM_SIZE && inst->rd >= 3;
+
+	case 19:													// in
+		return index >= 0 && index < NUM_OF_IO_REGISTERS && index != CLKS && index != TIMERCURRENT && inst->rd >= 3;
+
+	case 17: case 18: case 20: case 21:							// sw, reti, out, halt
+		return 0;
+
+	default:													// alu and jal
+		return inst->opcode < NUM_OF_OPCODES && inst->rd >= 3;
+	}
+}
+
+/*
+  description:
+	called from end_cycle in --fast-forward mode, once the next cycle's PC is known.
+
+	a loop is idle when a pass starting at the current PC comes back to it with every register unchanged and without
+	touching anything else: every following pass then repeats it exactly, until a peripheral event or an interrupt.
+	a PC is only examined the second time it is reached with the same registers. the pass is run once more on a copy
+	of the state to record it, then as many whole passes as end before the next scheduled event are skipped.
+
+*/
+void skip_idle_loop(simulator_t* sim) {
+
+	machine_state_t* state = &sim->state;
+	idle_candidate_t* candidate = &sim->idle_candidates[state->PC & (IDLE_CANDIDATES - 1)];
+	idle_cycle_t cycles[IDLE_MAX_LOOP];
+	machine_state_t probe;
+	uint32_t length = 0;
+	int64_t quiet, passes, pass;
+	uint32_t i;
+	int64_t clock;
+
+	if (!candidate->valid || candidate->PC != state->PC || memcmp(candidate->R, state->R, sizeof(state->R)) != 0) {
+
+		candidate->valid = 1;
+		candidate->PC = state->PC;
+		memcpy(candidate->R, state->R, sizeof(state->R));
+		return;
+	}
+
+	quiet = quiet_cycles(sim);
+
+	if (quiet == NO_EVENT_CYCLES) {
+		return;                                 // nothing is scheduled, the loop never ends. leave it running as before.
+	}
+
+	probe = *state;
+
+	do {
+
+		const decoded_instruction_t* inst = &sim->decoded_imem[probe.PC];
+
+		if (length == IDLE_MAX_LOOP || length >= quiet) {
+			return;
+		}
+
+		probe.R[1] = inst->imm1;
+		probe.R[2] = inst->imm2;
+
+		if (!idle_instruction(inst, probe.R)) {
+			return;
+		}
+
+		cycles[length].PC = probe.PC;
+		memcpy(cycles[length].R, probe.R, sizeof(probe.R));
+
+		execute_instruction(inst, &probe);
+		memcpy(cycles[length].hw_info, probe.hw_info, sizeof(probe.hw_info));
+		memset(probe.hw_info, 0, sizeof(probe.hw_info));
+
+		if (probe.PC_set_flag == 0) {
+			probe.PC = (probe.PC + 1) & PC_MASK;
+		}
+		probe.PC_set_flag = 0;
+
+		length++;
+
+	} while (probe.PC != state->PC);
+
+	if (memcmp(probe.R, state->R, sizeof(state->R)) != 0) {
+		return;
+	}
+
+	passes = quiet / length;
+	clock = sim->clock;
+
+	for (pass = 0; pass < passes; pass++) {
+
+		for (i = 0; i < length; i++, clock++) {
+
+			if (sim->trace_enabled) {
+				write_trace_row(sim, cycles[i].PC, cycles[i].R, clock);
+			}
+
+			if (cycles[i].hw_info[1] != 0) {
+
+				int hw_info[3];
+
+				memcpy(hw_info, cycles[i].hw_info, sizeof(hw_info));
+				log_hwregtrace(sim, hw_info, clock);
+			}
+		}
+	}
+
+	account_quiet_cycles(sim, passes * length);
+}
@@ -0,0 +1,21 @@
+#ifndef __IDLE_H__
+#define __IDLE_H__
+
+#include "simulator.h"
+
+/*
+  description:
+	idle loop fast-forward, selected with --fast-forward.
+
+	code waiting for a peripheral spins in a short loop, polling diskstatus or waiting for an interrupt, and every pass
+	does exactly the same thing until the peripheral event arrives. such loops are detected at the end of cycles that
+	branched or read an io register, and whole passes are skipped up to the next scheduled event. trace rows and
+	hwregtrace reads of the skipped cycles are replayed, so every output file stays the same.
+
+*/
+
+#define IDLE_MAX_LOOP 64				// longest loop, in cycles per pass, that is looked at.
+
+void skip_idle_loop(simulator_t* sim);
+
+#endif
@@ -0,0 +1,597 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stddef.h>
+
+#include "jit.h"
+
+#ifdef SIMP_JIT
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#endif
+
+#define JIT_BUFFER_SIZE (8 * 1024 * 1024)
+#define JIT_MAX_BLOCK 32
+#define JIT_MAX_INSTRUCTION_BYTES 160         // upper bound on the native code emitted for one instruction.
+#define JIT_BLOCK_MARGIN (JIT_MAX_BLOCK * JIT_MAX_INSTRUCTION_BYTES + 256)
+
+enum x86_register { RAX, RCX, RDX, RBX, RSP, RBP, RSI, RDI };
+
+/*
+  description:
+	state shared between the C driver and translated code. while translated code runs it is kept in registers:
+	rbx = R, r14 = dmem, r12 = blocks, r13 = budget, r15 = the context itself.
+
+*/
+typedef struct {
+	int32_t* R;
+	uint32_t* dmem;
+	uint8_t** blocks;					// native entry point per PC, NULL when not translated.
+	int64_t budget;						// quiet cycles left, decremented once per executed instruction.
+	uint8_t* patch_site;				// rel32 field of the jump that left translated code, NULL if it can't be chained.
+
+	simulator_t* sim;
+	int64_t start_budget;				// budget and clock on entry, used to number trace rows.
+	int64_t start_clock;
+} jit_context_t;
+
+typedef uint32_t (*jit_enter_t)(jit_context_t* ctx, uint8_t* block);
+
+typedef struct jit {
+	uint8_t* buffer;
+	size_t used;
+	size_t stubs_end;					// translated blocks start here, everything after is dropped on flush.
+	int generation;						// incremented on every flush.
+
+	uint8_t* enter;						// enter(ctx, block): saves callee-saved registers, loads the context, jumps to block.
+	uint8_t* exit;						// eax = next PC, rdx = patch site: stores budget and patch site, returns next PC.
+	uint8_t* lookup;					// eax = next PC: jumps to the translated block, or exits unchained.
+
+	uint8_t* blocks[MEM_SIZE];
+	uint8_t untranslatable[MEM_SIZE];
+	jit_context_t ctx;
+} jit_t;
+
+/*
+  description:
+	code emission helpers.
+
+*/
+static void emit8(jit_t* jit, uint8_t byte) {
+
+	jit->buffer[jit->used++] = byte;
+}
+
+static void emit32(jit_t* jit, uint32_t value) {
+
+	memcpy(jit->buffer + jit->used, &value, sizeof(value));
+	jit->used += sizeof(value);
+}
+
+static void emit64(jit_t* jit, uint64_t value) {
+
+	memcpy(jit->buffer + jit->used, &value, sizeof(value));
+	jit->used += sizeof(value);
+}
+
+static uint8_t* here(jit_t* jit) {
+
+	return jit->buffer + jit->used;
+}
+
+static void patch_rel32(uint8_t* site, uint8_t* target) {
+
+	int32_t rel = (int32_t)(target - (site + 4));
+	memcpy(site, &rel, sizeof(rel));
+}
+
+/*
+  description:
+	op r32, [rbx + 4 * simp_register] for the one byte opcodes mov (8B), add (03), sub (2B), and (23), or (0B), xor (33), cmp (3B).
+
+*/
+static void emit_op_register(jit_t* jit, uint8_t opcode, int x86_reg, int simp_reg) {
+
+	emit8(jit, opcode);
+	emit8(jit, 0x40 | (x86_reg << 3) | RBX);
+	emit8(jit, (uint8_t)(simp_reg * 4));
+}
+
+static void emit_load(jit_t* jit, int x86_reg, int simp_reg) {
+
+	emit_op_register(jit, 0x8B, x86_reg, simp_reg);
+}
+
+static void emit_store(jit_t* jit, int x86_reg, int simp_reg) {
+
+	emit_op_register(jit, 0x89, x86_reg, simp_reg);
+}
+
+static void emit_store_imm(jit_t* jit, int simp_reg, int32_t value) {
+
+	emit8(jit, 0xC7);
+	emit8(jit, 0x40 | RBX);
+	emit8(jit, (uint8_t)(simp_reg * 4));
+	emit32(jit, (uint32_t)value);
+}
+
+static uint8_t* emit_jmp(jit_t* jit) {
+
+	emit8(jit, 0xE9);
+	emit32(jit, 0);
+	return here(jit) - 4;
+}
+
+static uint8_t* emit_jcc(jit_t* jit, uint8_t condition) {
+
+	emit8(jit, 0x0F);
+	emit8(jit, condition);
+	emit32(jit, 0);
+	return here(jit) - 4;
+}
+
+static void emit_decrement_budget(jit_t* jit) {
+
+	emit8(jit, 0x49); emit8(jit, 0x83); emit8(jit, 0xED); emit8(jit, 0x01);     // sub r13, 1
+}
+
+/*
+  description:
+	leaves translated code with next PC = pc. patch_site is the rel32 field that jumped here, or NULL.
+
+*/
+static void emit_exit(jit_t* jit, uint32_t pc, uint8_t* patch_site) {
+
+	emit8(jit, 0xB8);                                                         // mov eax, pc
+	emit32(jit, pc);
+
+	if (patch_site != NULL) {
+		emit8(jit, 0x48); emit8(jit, 0xBA);                                    // mov rdx, patch_site
+		emit64(jit, (uint64_t)(uintptr_t)patch_site);
+	}
+	else {
+		emit8(jit, 0x31); emit8(jit, 0xD2);                                    // xor edx, edx
+	}
+
+	patch_rel32(emit_jmp(jit), jit->exit);
+}
+
+/*
+  description:
+	continues at a PC known at translation time, chained directly when that block already exists.
+
+*/
+static void emit_goto_static(jit_t* jit, uint32_t pc) {
+
+	uint8_t* site = emit_jmp(jit);
+
+	if (jit->blocks[pc] != NULL) {
+		patch_rel32(site, jit->blocks[pc]);
+	}
+	else {
+		patch_rel32(site, here(jit));
+		emit_exit(jit, pc, site);
+	}
+}
+
+/*
+  description:
+	continues at the PC held in simp_reg. $zero/$imm1/$imm2 are constants at translation time.
+
+*/
+static void emit_goto_register(jit_t* jit, const decoded_instruction_t* inst, int simp_reg) {
+
+	if (simp_reg == 0) {
+		emit_goto_static(jit, 0);
+	}
+	else if (simp_reg == 1) {
+		emit_goto_static(jit, inst->imm1 & PC_MASK);
+	}
+	else if (simp_reg == 2) {
+		emit_goto_static(jit, inst->imm2 & PC_MASK);
+	}
+	else {
+		emit_load(jit, RAX, simp_reg);
+		emit8(jit, 0x25);                                                     // and eax, PC_MASK
+		emit32(jit, PC_MASK);
+		patch_rel32(emit_jmp(jit), jit->lookup);
+	}
+}
+
+/*
+  description:
+	called from translated code before every instruction when the trace is enabled.
+
+*/
+static void jit_trace_row(jit_context_t* ctx, uint32_t pc, int64_t budget) {
+
+	simulator_t* sim = ctx->sim;
+	int64_t clock = ctx->start_clock + (ctx->start_budget - budget);
+
+	write_trace(sim, pc, clock);
+}
+
+static void emit_trace_call(jit_t* jit, uint32_t pc) {
+
+#ifdef _WIN32
+	emit8(jit, 0x4C); emit8(jit, 0x89); emit8(jit, 0xF9);                      // mov rcx, r15
+	emit8(jit, 0xBA); emit32(jit, pc);                                        // mov edx, pc
+	emit8(jit, 0x4D); emit8(jit, 0x89); emit8(jit, 0xE8);                      // mov r8, r13
+#else
+	emit8(jit, 0x4C); emit8(jit, 0x89); emit8(jit, 0xFF);                      // mov rdi, r15
+	emit8(jit, 0xBE); emit32(jit, pc);                                        // mov esi, pc
+	emit8(jit, 0x4C); emit8(jit, 0x89); emit8(jit, 0xEA);                      // mov rdx, r13
+#endif
+	emit8(jit, 0x48); emit8(jit, 0xB8);                                        // mov rax, jit_trace_row
+	emit64(jit, (uint64_t)(uintptr_t)&jit_trace_row);
+	emit8(jit, 0xFF); emit8(jit, 0xD0);                                        // call rax
+}
+
+/*
+  description:
+	eax = R[rs] + R[rt], leaving translated code at pc when it is not a valid dmem index.
+
+*/
+static void emit_memory_index(jit_t* jit, const decoded_instruction_t* inst, uint32_t pc, int check) {
+
+	emit_load(jit, RAX, inst->rs);
+	emit_op_register(jit, 0x03, RAX, inst->rt);
+
+	if (check) {
+
+		emit8(jit, 0x3D);                                                     // cmp eax, MEM_SIZE
+		emit32(jit, MEM_SIZE);
+
+		uint8_t* in_range = emit_jcc(jit, 0x82);                              // jb
+		emit_exit(jit, pc, NULL);                                             // the interpreter reports the bad index.
+		patch_rel32(in_range, here(jit));
+	}
+}
+
+/*
+  description:
+	1 if the instruction can run inside translated code.
+
+*/
+static int translatable(const decoded_instruction_t* inst) {
+
+	if (inst->opcode <= 8 || inst->opcode == 15 || inst->opcode == 16) {
+		return inst->rd >= 3;                                                 // writes to $zero/$imm are reported by the interpreter.
+	}
+
+	return inst->opcode <= 17;
+}
+
+/*
+  description:
+	translates the basic block starting at pc and returns its entry point.
+
+*/
+static uint8_t* translate_block(jit_t* jit, uint32_t pc) {
+
+	const decoded_instruction_t* decoded = jit->ctx.sim->decoded_imem;
+	int trace = jit->ctx.sim->trace_enabled;
+	uint32_t start = pc;
+	int length = 0;
+
+	while (length < JIT_MAX_BLOCK && translatable(&decoded[pc + length])) {   // find the block length first, for the budget check.
+
+		length++;
+
+		if (decoded[pc + length - 1].opcode >= 9 || pc + length > PC_MASK) {
+			break;                                                            // branches end the block, so does the end of imem.
+		}
+	}
+
+	uint8_t* entry = here(jit);
+
+	emit8(jit, 0x49); emit8(jit, 0x81); emit8(jit, 0xFD);                      // cmp r13, length
+	emit32(jit, length);
+	uint8_t* enough_budget = emit_jcc(jit, 0x83);                             // jae
+	emit_exit(jit, start, NULL);
+	patch_rel32(enough_budget, here(jit));
+
+	for (; pc < start + length; pc++) {
+
+		const decoded_instruction_t* inst = &decoded[pc];
+		uint8_t* taken;
+
+		emit_store_imm(jit, 1, inst->imm1);
+		emit_store_imm(jit, 2, inst->imm2);
+
+		if (inst->opcode == 16 || inst->opcode == 17) {
+			emit_memory_index(jit, inst, pc, 1);
+		}
+
+		if (trace) {
+			emit_trace_call(jit, pc);
+		}
+
+		switch (inst->opcode) {
+
+		case 0: case 1: case 3: case 4: case 5:   // add, sub, and, or, xor
+
+			emit_load(jit, RAX, inst->rs);
+			emit_op_register(jit, "\x03\x2B\x00\x23\x0B\x33"[inst->opcode], RAX, inst->rt);
+			emit_op_register(jit, "\x03\x2B\x00\x23\x0B\x33"[inst->opcode], RAX, inst->rm);
+			emit_store(jit, RAX, inst->rd);
+			break;
+
+		case 2:   // mac
+
+			emit_load(jit, RAX, inst->rs);
+			emit8(jit, 0x0F);                                                 // imul eax, [rbx + 4 * rt]
+			emit_op_register(jit, 0xAF, RAX, inst->rt);
+			emit_op_register(jit, 0x2B, RAX, inst->rm);
+			emit_store(jit, RAX, inst->rd);
+			break;
+
+		case 6: case 7: case 8:   // sll, sra, srl - x86 takes the shift count modulo 32 as well
+
+			emit_load(jit, RAX, inst->rs);
+			emit_load(jit, RCX, inst->rt);
+			emit8(jit, 0xD3);
+			emit8(jit, inst->opcode == 6 ? 0xE0 : (inst->opcode == 7 ? 0xF8 : 0xE8));
+			emit_store(jit, RAX, inst->rd);
+			break;
+
+		case 16:  // lw
+
+			emit_memory_index(jit, inst, pc, 0);
+			emit8(jit, 0x41); emit8(jit, 0x8B); emit8(jit, 0x04); emit8(jit, 0x86);   // mov eax, [r14 + rax * 4]
+			emit_op_register(jit, 0x03, RAX, inst->rm);
+			emit_store(jit, RAX, inst->rd);
+			break;
+
+		case 17:  // sw
+
+			emit_load(jit, RCX, inst->rm);
+			emit_op_register(jit, 0x03, RCX, inst->rd);
+			emit_memory_index(jit, inst, pc, 0);
+			emit8(jit, 0x41); emit8(jit, 0x89); emit8(jit, 0x0C); emit8(jit, 0x86);   // mov [r14 + rax * 4], ecx
+			break;
+
+		case 15:  // jal
+
+			emit_decrement_budget(jit);
+			emit_store_imm(jit, inst->rd, pc + 1);
+			emit_goto_register(jit, inst, inst->rm);
+			break;
+
+		default:  // beq, bne, blt, bgt, ble, bge
+
+			emit_decrement_budget(jit);
+			emit_load(jit, RAX, inst->rs);
+			emit_op_register(jit, 0x3B, RAX, inst->rt);
+			taken = emit_jcc(jit, "\x84\x85\x8C\x8F\x8E\x8D"[inst->opcode - 9]);
+			emit_goto_static(jit, (pc + 1) & PC_MASK);
+			patch_rel32(taken, here(jit));
+			emit_goto_register(jit, inst, inst->rm);
+			break;
+		}
+
+		if (inst->opcode < 9 || inst->opcode > 15) {
+			emit_decrement_budget(jit);
+		}
+	}
+
+	if (decoded[start + length - 1].opcode < 9 || decoded[start + length - 1].opcode > 15) {
+		emit_goto_static(jit, pc & PC_MASK);                                  // block ended without a branch.
+	}
+
+	jit->blocks[start] = entry;
+	return entry;
+}
+
+static void jit_flush(jit_t* jit) {
+
+	memset(jit->blocks, 0, sizeof(jit->blocks));
+	memset(jit->untranslatable, 0, sizeof(jit->untranslatable));
+	jit->used = jit->stubs_end;
+	jit->generation++;
+}
+
+/*
+  description:
+	returns the translated block at pc, translating it on first use. NULL if the instruction at pc is left to the interpreter.
+
+*/
+static uint8_t* jit_block(jit_t* jit, uint32_t pc) {
+
+	if (jit->blocks[pc] != NULL) {
+		return jit->blocks[pc];
+	}
+
+	if (jit->untranslatable[pc]) {
+		return NULL;
+	}
+
+	if (!translatable(&jit->ctx.sim->decoded_imem[pc])) {
+		jit->untranslatable[pc] = 1;
+		return NULL;
+	}
+
+	if (jit->used + JIT_BLOCK_MARGIN > JIT_BUFFER_SIZE) {
+		jit_flush(jit);
+	}
+
+	return translate_block(jit, pc);
+}
+
+/*
+  description:
+	allocates the executable buffer and emits the enter/exit/lookup stubs.
+
+*/
+static jit_t* jit_create(simulator_t* sim) {
+
+	jit_t* jit = calloc_and_check(1, sizeof(jit_t));
+
+#ifdef _WIN32
+	jit->buffer = VirtualAlloc(NULL, JIT_BUFFER_SIZE, MEM_COMMIT | MEM_RESERVE, PAGE_EXECUTE_READWRITE);
+#else
+	jit->buffer = mmap(NULL, JIT_BUFFER_SIZE, PROT_READ | PROT_WRITE | PROT_EXEC, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (jit->buffer == MAP_FAILED) jit->buffer = NULL;
+#endif
+
+	if (jit->buffer == NULL) {
+		printf("Memory assignment error encountered\nTerminating program...");
+		exit(-1);
+	}
+
+	jit->ctx.sim = sim;
+	jit->ctx.R = sim->state.R;
+	jit->ctx.dmem = sim->state.dmem;
+	jit->ctx.blocks = jit->blocks;
+
+	//------------- exit: eax = next PC, rdx = patch site
+
+	jit->exit = here(jit);
+	emit8(jit, 0x49); emit8(jit, 0x89); emit8(jit, 0x97); emit32(jit, offsetof(jit_context_t, patch_site));   // mov [r15 + patch_site], rdx
+	emit8(jit, 0x4D); emit8(jit, 0x89); emit8(jit, 0xAF); emit32(jit, offsetof(jit_context_t, budget));       // mov [r15 + budget], r13
+	emit8(jit, 0x48); emit8(jit, 0x83); emit8(jit, 0xC4); emit8(jit, 0x28);                                    // add rsp, 40
+	emit8(jit, 0x41); emit8(jit, 0x5F);                                                                        // pop r15
+	emit8(jit, 0x41); emit8(jit, 0x5E);                                                                        // pop r14
+	emit8(jit, 0x41); emit8(jit, 0x5D);                                                                        // pop r13
+	emit8(jit, 0x41); emit8(jit, 0x5C);                                                                        // pop r12
+	emit8(jit, 0x5D);                                                                                          // pop rbp
+	emit8(jit, 0x5B);                                                                                          // pop rbx
+	emit8(jit, 0xC3);                                                                                          // ret
+
+	//------------- lookup: eax = next PC
+
+	jit->lookup = here(jit);
+	emit8(jit, 0x49); emit8(jit, 0x8B); emit8(jit, 0x14); emit8(jit, 0xC4);    // mov rdx, [r12 + rax * 8]
+	emit8(jit, 0x48); emit8(jit, 0x85); emit8(jit, 0xD2);                      // test rdx, rdx
+	uint8_t* not_translated = emit_jcc(jit, 0x84);                            // jz
+	emit8(jit, 0xFF); emit8(jit, 0xE2);                                        // jmp rdx
+	patch_rel32(not_translated, here(jit));
+	patch_rel32(emit_jmp(jit), jit->exit);                                    // rdx = 0, nothing to chain
+
+	//------------- enter(ctx, block)
+
+	jit->enter = here(jit);
+	emit8(jit, 0x53);                                                          // push rbx
+	emit8(jit, 0x55);                                                          // push rbp
+	emit8(jit, 0x41); emit8(jit, 0x54);                                        // push r12
+	emit8(jit, 0x41); emit8(jit, 0x55);                                        // push r13
+	emit8(jit, 0x41); emit8(jit, 0x56);                                        // push r14
+	emit8(jit, 0x41); emit8(jit, 0x57);                                        // push r15
+	emit8(jit, 0x48); emit8(jit, 0x83); emit8(jit, 0xEC); emit8(jit, 0x28);    // sub rsp, 40 - keeps calls aligned, shadow space on win64
+#ifdef _WIN32
+	emit8(jit, 0x49); emit8(jit, 0x89); emit8(jit, 0xCF);                      // mov r15, rcx
+#else
+	emit8(jit, 0x49); emit8(jit, 0x89); emit8(jit, 0xFF);                      // mov r15, rdi
+#endif
+	emit8(jit, 0x49); emit8(jit, 0x8B); emit8(jit, 0x9F); emit32(jit, offsetof(jit_context_t, R));            // mov rbx, [r15 + R]
+	emit8(jit, 0x4D); emit8(jit, 0x8B); emit8(jit, 0xB7); emit32(jit, offsetof(jit_context_t, dmem));         // mov r14, [r15 + dmem]
+	emit8(jit, 0x4D); emit8(jit, 0x8B); emit8(jit, 0xA7); emit32(jit, offsetof(jit_context_t, blocks));       // mov r12, [r15 + blocks]
+	emit8(jit, 0x4D); emit8(jit, 0x8B); emit8(jit, 0xAF); emit32(jit, offsetof(jit_context_t, budget));       // mov r13, [r15 + budget]
+#ifdef _WIN32
+	emit8(jit, 0xFF); emit8(jit, 0xE2);                                        // jmp rdx
+#else
+	emit8(jit, 0xFF); emit8(jit, 0xE6);                                        // jmp rsi
+#endif
+
+	jit->stubs_end = jit->used;
+	return jit;
+}
+
+void jit_free(simulator_t* sim) {
+
+	jit_t* jit = sim->jit;
+
+	if (jit == NULL) {
+		return;
+	}
+
+#ifdef _WIN32
+	VirtualFree(jit->buffer, 0, MEM_RELEASE);
+#else
+	munmap(jit->buffer, JIT_BUFFER_SIZE);
+#endif
+	free(jit);
+	sim->jit = NULL;
+}
+
+int jit_available(void) {
+
+	return 1;
+}
+
+/*
+  description:
+	runs translated code for as many quiet cycles as the peripherals allow, and single steps the interpreter through
+	every other cycle and every instruction that was not translated. the code cache is created on the first call and
+	re-entered by every later one, so a core run a slice at a time translates its program once.
+
+*/
+void run_jit(simulator_t* sim) {
+
+	if (sim->jit == NULL) {
+		sim->jit = jit_create(sim);
+	}
+
+	jit_t* jit = sim->jit;
+	jit_enter_t enter = (jit_enter_t)(void*)jit->enter;
+	const decoded_instruction_t* inst;
+
+	for (;;) {
+
+		int64_t budget = quiet_cycles(sim);
+		uint8_t* block = budget > 0 ? jit_block(jit, sim->state.PC) : NULL;
+
+		if (block != NULL) {
+
+			jit->ctx.budget = budget;
+			jit->ctx.start_budget = budget;
+			jit->ctx.start_clock = sim->clock;
+			jit->ctx.patch_site = NULL;
+
+			sim->state.PC = enter(&jit->ctx, block);
+			int64_t executed = budget - jit->ctx.budget;
+			account_quiet_cycles(sim, executed);
+
+			if (jit->ctx.patch_site != NULL) {                                // chain the jump that left, if its target translates.
+
+				int generation = jit->generation;
+				uint8_t* target = jit_block(jit, sim->state.PC);
+
+				if (target != NULL && generation == jit->generation) {
+					patch_rel32(jit->ctx.patch_site, target);
+				}
+			}
+
+			if (executed > 0) {
+				continue;
+			}
+		}
+
+		inst = begin_cycle(sim);
+		execute_instruction(inst, &sim->state);
+
+		if (end_cycle(sim)) {
+			break;
+		}
+	}
+}
+
+#else
+
+int jit_available(void) {
+
+	return 0;
+}
+
+void run_jit(simulator_t* sim) {
+
+}
+
+void jit_free(simulator_t* sim) {
+
+}
+
+#endif
@@ -0,0 +1,24 @@
+#ifndef __JIT_H__
+#define __JIT_H__
+
+#include "simulator.h"
+
+/*
+  description:
+	x86-64 basic block translator.
+
+	straight-line runs of ALU, lw/sw and branch instructions are translated to native code in an executable buffer and
+	chained to each other directly. in/out/reti/halt, writes to $zero/$imm and out of range memory accesses are left to
+	the interpreter, which also handles every cycle on which a peripheral or interrupt event can happen.
+
+*/
+
+#if (defined(__x86_64__) || defined(_M_X64)) && !defined(SIMP_NO_JIT)
+#define SIMP_JIT 1
+#endif
+
+int jit_available(void);
+void run_jit(simulator_t* sim);
+void jit_free(simulator_t* sim);
+
+#endif
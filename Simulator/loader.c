@@ -0,0 +1,284 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "loader.h"
+#include "simulator.h"
+#include "../Common/hex.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+static void io_error(void) {
+
+	printf("IO error encountered\nTerminating program...");
+	exit(-1);
+}
+
+/*
+  description:
+	maps a whole file read only. an empty file, or no file name at all, maps to no data.
+
+*/
+void map_file(char* p_fname, mapped_file_t* file) {
+
+	file->data = NULL;
+	file->size = 0;
+
+#ifdef _WIN32
+	LARGE_INTEGER size;
+
+	file->mapping = NULL;
+	file->file = INVALID_HANDLE_VALUE;
+
+	if (p_fname == NULL) {
+		return;
+	}
+
+	file->file = CreateFileA(p_fname, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+
+	if (file->file == INVALID_HANDLE_VALUE || !GetFileSizeEx(file->file, &size)) {
+		io_error();
+	}
+
+	if (size.QuadPart == 0) {
+		return;
+	}
+
+	file->mapping = CreateFileMappingA(file->file, NULL, PAGE_READONLY, 0, 0, NULL);
+	file->data = file->mapping != NULL ? MapViewOfFile(file->mapping, FILE_MAP_READ, 0, 0, 0) : NULL;
+
+	if (file->data == NULL) {
+		io_error();
+	}
+
+	file->size = (size_t)size.QuadPart;
+#else
+	struct stat status;
+	void* data;
+	int fd;
+
+	if (p_fname == NULL) {
+		return;
+	}
+
+	fd = open(p_fname, O_RDONLY);
+
+	if (fd < 0 || fstat(fd, &status) != 0) {
+		io_error();
+	}
+
+	if (status.st_size > 0) {
+
+		data = mmap(NULL, (size_t)status.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+		if (data == MAP_FAILED) {
+			io_error();
+		}
+
+		madvise(data, (size_t)status.st_size, MADV_SEQUENTIAL);
+		file->data = data;
+		file->size = (size_t)status.st_size;
+	}
+
+	close(fd);
+#endif
+}
+
+void unmap_file(mapped_file_t* file) {
+
+#ifdef _WIN32
+	if (file->data != NULL) UnmapViewOfFile(file->data);
+	if (file->mapping != NULL) CloseHandle(file->mapping);
+	if (file->file != INVALID_HANDLE_VALUE) CloseHandle(file->file);
+
+	file->mapping = NULL;
+	file->file = INVALID_HANDLE_VALUE;
+#else
+	if (file->data != NULL) munmap((void*)file->data, file->size);
+#endif
+
+	file->data = NULL;
+	file->size = 0;
+}
+
+/*
+  description:
+	start of the line after the one at p, or end.
+
+*/
+static const char* next_line(const char* p, const char* end) {
+
+	const char* newline = memchr(p, '\n', (size_t)(end - p));
+
+	return newline != NULL ? newline + 1 : end;
+}
+
+static int empty_line(const char* p, const char* end) {
+
+	return p == end || *p == '\n' || *p == '\r';
+}
+
+/*
+  description:
+	reads a text file of fixed size lines, data_size lines of line_size characters, with no separators.
+	used for imemin, whose text the trace prints as it appears in the file. missing lines and characters read as '0'.
+
+*/
+char* readfile(char* p_fname, int line_size, int data_size) {
+
+	mapped_file_t file;
+	char* data = calloc_and_check((size_t)data_size * line_size + 1, sizeof(char));
+	const char* p;
+	const char* end;
+	int i, j;
+
+	memset(data, '0', (size_t)data_size * line_size);
+
+	map_file(p_fname, &file);
+	p = file.data;
+	end = file.data + file.size;
+
+	for (i = 0; i < data_size && !empty_line(p, end); i++) {
+
+		char* line = data + (size_t)i * line_size;
+
+		for (j = 0; j < line_size && p + j < end && p[j] != '\n' && p[j] != '\r'; j++) {
+			line[j] = p[j];
+		}
+
+		p = next_line(p, end);
+	}
+
+	unmap_file(&file);
+	return data;
+}
+
+/*
+  description:
+	parses lines of hex words at p into image, up to 'words' of them, stopping early at an empty line or at end.
+	runs of regular 8 digit lines go through the bulk decoder, anything else a line at a time.
+	returns where parsing stopped: the start of the next line, an empty line or end.
+
+*/
+const char* parse_memory_lines(uint32_t* image, int words, int line_size, const char* p, const char* end) {
+
+	int i = 0;
+
+	while (i < words && !empty_line(p, end)) {
+
+		if (line_size == 8) {
+
+			size_t lines = (size_t)(end - p) / 9;			// lines that fit what is left, if they are regular.
+			size_t decoded = hex_decode_lines(image + i, p, lines < (size_t)(words - i) ? lines : (size_t)(words - i));
+			i += (int)decoded;
+			p += decoded * 9;
+
+			if (i == words || empty_line(p, end)) {
+				break;
+			}
+		}
+
+		image[i++] = hex_parse(p, end - p < line_size ? (int)(end - p) : line_size);		// a short, long or CRLF line.
+		p = next_line(p, end);
+	}
+
+	return p;
+}
+
+/*
+  description:
+	start of the line 'lines' lines after p, stopping early at an empty line or at end.
+
+*/
+const char* skip_lines(const char* p, const char* end, int lines) {
+
+	int i;
+
+	for (i = 0; i < lines && !empty_line(p, end); i++) {
+		p = next_line(p, end);
+	}
+
+	return p;
+}
+
+/*
+  description:
+	reads a file of hex words, one per line, into a binary image of 'words' words.
+
+*/
+uint32_t* read_memory_image(char* p_fname, int line_size, int words) {
+
+	mapped_file_t file;
+	uint32_t* image = calloc_and_check(words, sizeof(uint32_t));
+
+	map_file(p_fname, &file);
+	parse_memory_lines(image, words, line_size, file.data, file.data + file.size);
+	unmap_file(&file);
+
+	return image;
+}
+
+/*
+  description:
+	reads irq2in, one decimal clock per line. returns the clocks and stores their number in num_of_clocks.
+
+*/
+int* readirq2(char* p_fname, int* num_of_clocks) {
+
+	mapped_file_t file;
+	int capacity = 32;
+	int count = 0;
+	int* clocks = calloc_and_check(capacity, sizeof(int));
+	const char* p;
+	const char* end;
+
+	map_file(p_fname, &file);
+	p = file.data;
+	end = file.data + file.size;
+
+	while (!empty_line(p, end)) {
+
+		int negative = 0;
+		uint32_t value = 0;
+
+		while (p < end && (*p == ' ' || *p == '\t')) p++;
+
+		if (p < end && (*p == '-' || *p == '+')) {
+			negative = *p == '-';
+			p++;
+		}
+
+		while (p < end && (uint8_t)(*p - '0') < 10) {
+			value = value * 10 + (uint32_t)(*p - '0');
+			p++;
+		}
+
+		if (count == capacity) {
+
+			int* temp_buffer = realloc(clocks, 2 * capacity * sizeof(int));
+
+			if (temp_buffer == NULL) {
+				printf("Memory assignment error encountered\nTerminating program...");
+				exit(-1);
+			}
+
+			clocks = temp_buffer;
+			capacity *= 2;
+		}
+
+		clocks[count++] = negative ? -(int)value : (int)value;
+		p = next_line(p, end);
+	}
+
+	unmap_file(&file);
+
+	*num_of_clocks = count;
+	return clocks;
+}
@@ -0,0 +1,34 @@
+#ifndef __LOADER_H__
+#define __LOADER_H__
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+  description:
+	input files are mapped read only and parsed in a single pass straight into their in-memory form, without
+	copying lines around. an empty line ends a file, lines past the image size are ignored and missing lines read
+	as zero. CRLF line ends are accepted.
+
+*/
+
+typedef struct {
+	const char* data;
+	size_t size;
+#ifdef _WIN32
+	void* file;
+	void* mapping;
+#endif
+} mapped_file_t;
+
+void map_file(char* p_fname, mapped_file_t* file);
+void unmap_file(mapped_file_t* file);
+
+const char* parse_memory_lines(uint32_t* image, int words, int line_size, const char* p, const char* end);
+const char* skip_lines(const char* p, const char* end, int lines);
+
+char* readfile(char* p_fname, int line_size, int data_size);
+uint32_t* read_memory_image(char* p_fname, int line_size, int words);
+int* readirq2(char* p_fname, int* num_of_clocks);
+
+#endif
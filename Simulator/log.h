@@ -0,0 +1,39 @@
+#ifndef __LOG_H__
+#define __LOG_H__
+
+#include <stdio.h>
+
+/*
+  description:
+	console logging with a level chosen at run time (--log=error|warning|info|debug, default info).
+
+	debug is the per-cycle dump: PC, clock, trace line, $a0/$a1 and part of dmem. building with SIMP_NO_DEBUG_LOG
+	compiles it out entirely, otherwise it costs one compare per call site when disabled.
+	fatal errors are printed unconditionally before exiting and don't go through here.
+
+*/
+
+typedef enum {
+	LOG_LEVEL_ERROR,
+	LOG_LEVEL_WARNING,
+	LOG_LEVEL_INFO,
+	LOG_LEVEL_DEBUG
+} log_level_t;
+
+extern log_level_t log_level;
+
+#define LOG_AT(level, ...)	do { if ((level) <= log_level) printf(__VA_ARGS__); } while (0)
+
+#define LOG_ERROR(...)		LOG_AT(LOG_LEVEL_ERROR, __VA_ARGS__)
+#define LOG_WARNING(...)	LOG_AT(LOG_LEVEL_WARNING, __VA_ARGS__)
+#define LOG_INFO(...)		LOG_AT(LOG_LEVEL_INFO, __VA_ARGS__)
+
+#ifdef SIMP_NO_DEBUG_LOG
+#define LOG_DEBUG_ENABLED	0
+#define LOG_DEBUG(...)		do { } while (0)
+#else
+#define LOG_DEBUG_ENABLED	(log_level >= LOG_LEVEL_DEBUG)
+#define LOG_DEBUG(...)		LOG_AT(LOG_LEVEL_DEBUG, __VA_ARGS__)
+#endif
+
+#endif
@@ -0,0 +1,374 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "multicore.h"
+#include "trace_binary.h"
+#include "output.h"
+#include "jit.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+/*
+  description:
+	acquire/release access to the barrier and the device lock. Interlocked functions are full barriers on every
+	Windows target, a plain access with a compiler barrier would only be ordered on x86 and x64.
+
+*/
+#ifdef _WIN32
+static uint32_t load_acquire(volatile uint32_t* p) { return (uint32_t)InterlockedCompareExchange((volatile LONG*)p, 0, 0); }
+static void store_release(volatile uint32_t* p, uint32_t value) { InterlockedExchange((volatile LONG*)p, (LONG)value); }
+static uint32_t arrive(volatile uint32_t* p) { return (uint32_t)InterlockedIncrement((volatile LONG*)p); }
+static uint32_t take_lock(volatile uint32_t* p) { return (uint32_t)InterlockedExchange((volatile LONG*)p, 1); }
+static void yield_thread(void) { SwitchToThread(); }
+#else
+static uint32_t load_acquire(volatile uint32_t* p) { return __atomic_load_n(p, __ATOMIC_ACQUIRE); }
+static void store_release(volatile uint32_t* p, uint32_t value) { __atomic_store_n(p, value, __ATOMIC_RELEASE); }
+static uint32_t arrive(volatile uint32_t* p) { return __atomic_add_fetch(p, 1, __ATOMIC_ACQ_REL); }
+static uint32_t take_lock(volatile uint32_t* p) { return __atomic_exchange_n(p, 1, __ATOMIC_ACQUIRE); }
+static void yield_thread(void) { sched_yield(); }
+#endif
+
+void lock_devices(multicore_t* multicore) {
+
+	while (take_lock(&multicore->device_lock) != 0) {
+		yield_thread();
+	}
+}
+
+void unlock_devices(multicore_t* multicore) {
+
+	store_release(&multicore->device_lock, 0);
+}
+
+/*
+  description:
+	fname with _coreK inserted before its extension, a new string. NULL stays NULL.
+
+*/
+static char* core_fname(const char* fname, int core) {
+
+	if (fname == NULL) {
+		return NULL;
+	}
+
+	const char* dot = strrchr(fname, '.');
+	const char* slash = strrchr(fname, '/');
+	const char* backslash = strrchr(fname, '\\');
+	size_t size = strlen(fname) + 16;
+	char* name = calloc_and_check(size, sizeof(char));
+
+	if (dot == NULL || (slash != NULL && slash > dot) || (backslash != NULL && backslash > dot)) {
+		dot = fname + strlen(fname);     // no extension.
+	}
+
+	sprintf_s(name, size, "%.*s_core%d%s", (int)(dot - fname), fname, core, dot);
+
+	return name;
+}
+
+/*
+  description:
+	adds cores 1 to config.cores - 1 to a loaded machine. they share imem, dmem, irq2in, the disk and the monitor
+	with core 0 and start from reset, with coreid set.
+
+*/
+multicore_t* multicore_load(simp_machine_t* machine) {
+
+	multicore_t* multicore = calloc_and_check(1, sizeof(multicore_t));
+	simulator_t* first = &machine->sim;
+	const simp_config_t* config = &machine->config;
+
+	multicore->num_of_cores = config->cores;
+	multicore->cores = calloc_and_check(config->cores, sizeof(simp_machine_t*));
+	multicore->engine = config->engine;
+	multicore->quantum = config->quantum;
+	multicore->cores[0] = machine;
+
+	first->multicore = multicore;
+
+	for (int core = 1; core < multicore->num_of_cores; core++) {
+
+		simp_machine_t* other = calloc_and_check(1, sizeof(simp_machine_t));
+		simp_config_t* names = &other->config;
+		simulator_t* sim = &other->sim;
+
+		memset(names, 0, sizeof(simp_config_t));      // only the core's own outputs, simp_dump skips the rest.
+		names->trace = core_fname(config->trace, core);
+		names->hwregtrace = core_fname(config->hwregtrace, core);
+		names->cycles = core_fname(config->cycles, core);
+		names->leds = core_fname(config->leds, core);
+		names->display7seg = core_fname(config->display7seg, core);
+		names->regout = core_fname(config->regout, core);
+
+		sim->imem = first->imem;
+		sim->decoded_imem = first->decoded_imem;
+		sim->state.dmem = first->state.dmem;
+		sim->disk = first->disk;
+		sim->monitor = first->monitor;
+		sim->monitor_hex = first->monitor_hex;
+		sim->irq2_up_clocks = first->irq2_up_clocks;
+		sim->num_irq2_up_clocks = first->num_irq2_up_clocks;
+
+		sim->core_id = core;
+		sim->state.IO[COREID] = core;
+		sim->multicore = multicore;
+
+		sim->trace_enabled = first->trace_enabled;
+		sim->trace_binary = first->trace_binary;
+
+		if (sim->trace_enabled) {
+
+			sim->trace = writer_open(names->trace, WRITER_BUFFER_SIZE, sim->trace_binary);
+
+			if (sim->trace_binary) {
+				write_binary_trace_header(sim->trace, sim->imem);
+			}
+		}
+
+		event_log_init(&sim->hwregtrace_log, names->hwregtrace);
+		event_log_init(&sim->leds_log, names->leds);
+		event_log_init(&sim->display7seg_log, names->display7seg);
+
+		if (config->async_output) {
+			sim->output = output_start(sim);
+		}
+
+		init_events(sim);
+
+		multicore->cores[core] = other;
+	}
+
+	return multicore;
+}
+
+static int all_halted(const multicore_t* multicore) {
+
+	for (int core = 0; core < multicore->num_of_cores; core++) {
+		if (!multicore->cores[core]->sim.state.halt_flag) {
+			return 0;
+		}
+	}
+
+	return 1;
+}
+
+/*
+  description:
+	runs up to max_cycles clock cycles, a cycle of every running core in core order per clock cycle.
+	returns SIMP_HALTED once every core halted, SIMP_RUNNING otherwise.
+
+*/
+int run_lockstep(multicore_t* multicore, int64_t max_cycles) {
+
+	int core;
+
+	for (core = 0; core < multicore->num_of_cores; core++) {
+
+		simulator_t* sim = &multicore->cores[core]->sim;
+
+		sim->run_limit = NEVER;      // the cycles are counted here.
+		schedule_event(&sim->events, EVENT_RUN_LIMIT, NEVER);
+	}
+
+	for (int64_t cycle = 0; cycle < max_cycles; cycle++) {
+
+		int running = 0;
+
+		for (core = 0; core < multicore->num_of_cores; core++) {
+
+			simulator_t* sim = &multicore->cores[core]->sim;
+
+			if (!sim->state.halt_flag) {
+
+				execute_instruction(begin_cycle(sim), &sim->state);
+				end_cycle(sim);
+
+				running |= !sim->state.halt_flag;
+			}
+		}
+
+		if (!running) {
+			break;
+		}
+	}
+
+	return all_halted(multicore) ? SIMP_HALTED : SIMP_RUNNING;
+}
+
+/*
+  description:
+	waits for every core to reach the barrier. the last one to arrive moves the generation on and releases the rest.
+
+*/
+static void barrier_wait(multicore_t* multicore) {
+
+	uint32_t generation = load_acquire(&multicore->generation);
+
+	if (arrive(&multicore->arrived) == (uint32_t)multicore->num_of_cores) {
+
+		multicore->arrived = 0;
+		store_release(&multicore->generation, generation + 1);
+	}
+	else {
+
+		while (load_acquire(&multicore->generation) == generation) {
+			yield_thread();
+		}
+	}
+}
+
+typedef struct {
+	multicore_t* multicore;
+	simulator_t* sim;
+} core_thread_t;
+
+/*
+  description:
+	a free running core's thread: a slice of cycles between two barriers, until run_multicore stops the threads.
+
+*/
+#ifdef _WIN32
+static DWORD WINAPI core_thread(LPVOID argument) {
+#else
+static void* core_thread(void* argument) {
+#endif
+
+	core_thread_t* thread = argument;
+	multicore_t* multicore = thread->multicore;
+
+	for (;;) {
+
+		barrier_wait(multicore);
+
+		if (load_acquire(&multicore->stopping)) {
+			break;
+		}
+
+		run_engine(thread->sim, multicore->engine, multicore->slice);
+		barrier_wait(multicore);
+	}
+
+	return 0;
+}
+
+/*
+  description:
+	runs up to max_cycles clock cycles, in lockstep or, with a quantum, free running: cores 1 and up on threads
+	started for the call, core 0 on the caller's thread, meeting every quantum cycles.
+	returns SIMP_HALTED once every core halted, SIMP_RUNNING otherwise.
+
+*/
+int run_multicore(multicore_t* multicore, int64_t max_cycles) {
+
+	int threads_count = multicore->num_of_cores - 1;
+	core_thread_t* arguments;
+	int core;
+
+	if (multicore->quantum == 0) {
+		return run_lockstep(multicore, max_cycles);
+	}
+
+	if (all_halted(multicore) || max_cycles <= 0) {
+		return all_halted(multicore) ? SIMP_HALTED : SIMP_RUNNING;
+	}
+
+	arguments = calloc_and_check(threads_count, sizeof(core_thread_t));
+
+#ifdef _WIN32
+	HANDLE* threads = calloc_and_check(threads_count, sizeof(HANDLE));
+#else
+	pthread_t* threads = calloc_and_check(threads_count, sizeof(pthread_t));
+#endif
+
+	for (core = 0; core < threads_count; core++) {
+
+		arguments[core].multicore = multicore;
+		arguments[core].sim = &multicore->cores[core + 1]->sim;
+
+#ifdef _WIN32
+		threads[core] = CreateThread(NULL, 0, core_thread, &arguments[core], 0, NULL);
+		if (threads[core] == NULL) {
+#else
+		if (pthread_create(&threads[core], NULL, core_thread, &arguments[core]) != 0) {
+#endif
+			printf("Thread creation error encountered\nTerminating program...");
+			exit(-1);
+		}
+	}
+
+	while (max_cycles > 0 && !all_halted(multicore)) {
+
+		multicore->slice = max_cycles < multicore->quantum ? max_cycles : multicore->quantum;
+
+		barrier_wait(multicore);     // the slice starts.
+		run_engine(&multicore->cores[0]->sim, multicore->engine, multicore->slice);
+		barrier_wait(multicore);     // every core ran it.
+
+		max_cycles -= multicore->slice;
+	}
+
+	store_release(&multicore->stopping, 1);
+	barrier_wait(multicore);
+
+	for (core = 0; core < threads_count; core++) {
+
+#ifdef _WIN32
+		WaitForSingleObject(threads[core], INFINITE);
+		CloseHandle(threads[core]);
+#else
+		pthread_join(threads[core], NULL);
+#endif
+	}
+
+	multicore->stopping = 0;
+
+	free(threads);
+	free(arguments);
+
+	return all_halted(multicore) ? SIMP_HALTED : SIMP_RUNNING;
+}
+
+/*
+  description:
+	closes the streamed outputs of cores 1 and up and releases them. what they share is core 0's, freed with the machine.
+
+*/
+void multicore_free(multicore_t* multicore) {
+
+	for (int core = 1; core < multicore->num_of_cores; core++) {
+
+		simp_machine_t* other = multicore->cores[core];
+		simulator_t* sim = &other->sim;
+		simp_config_t* names = &other->config;
+
+		if (sim->output != NULL) {
+			output_stop(sim->output);
+		}
+
+		if (sim->trace != NULL) {
+			writer_close(sim->trace);
+		}
+
+		event_log_close(&sim->hwregtrace_log);
+		event_log_close(&sim->leds_log);
+		event_log_close(&sim->display7seg_log);
+		jit_free(sim);
+
+		free(names->trace);
+		free(names->hwregtrace);
+		free(names->cycles);
+		free(names->leds);
+		free(names->display7seg);
+		free(names->regout);
+		free(other);
+	}
+
+	free(multicore->cores);
+	free(multicore);
+}
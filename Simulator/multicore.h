@@ -0,0 +1,51 @@
+#ifndef __MULTICORE_H__
+#define __MULTICORE_H__
+
+#include "simp.h"
+
+/*
+  description:
+	multi-core machines, --cores=N: N SIMP cores running the same imem from PC 0 over one dmem. each core has its
+	own registers, PC and IO register bank: irq state, timer, clks, leds, display7seg and disk controller. coreid
+	reads as the core's number, so that the program can tell the cores apart. the disk and the monitor are shared
+	devices, and irq2in raises irq2 on every core.
+
+	core 0 is the machine's own simulator_t and writes the files the config names. core K writes its trace,
+	hwregtrace, leds, display7seg, regout and cycles under the same names with _coreK before the extension,
+	trace_core1.txt for trace.txt. dmemout, diskout and the monitor belong to the machine.
+
+	lockstep, the default, runs the cores on the caller's thread on the switch interpreter, a cycle of each core in
+	core order per clock cycle. dmem accesses always interleave the same way, so the outputs are reproducible.
+
+	free running, --quantum=Q, runs each core on a host thread of its own with the configured engine. the cores meet
+	at a barrier every Q cycles, so that none runs more than Q cycles ahead of another. in between, dmem accesses
+	interleave as the host schedules the threads: cores that share data have to synchronize through dmem, and the
+	outputs can change from run to run. disk transfers and monitor writes are serialized.
+
+	the machine halts once every core executed halt, each core's outputs end at its own halt.
+
+*/
+
+#define MULTICORE_MAX_CORES 64
+
+typedef struct multicore {
+	int num_of_cores;
+	simp_machine_t** cores;				// cores[0] is the machine, the others only hold a core and its output names.
+	engine_t engine;
+	int64_t quantum;					// cycles between barriers, 0 in lockstep.
+
+	volatile uint32_t device_lock;		// held around disk transfers and monitor writes.
+	volatile uint32_t arrived;			// cores waiting at the barrier.
+	volatile uint32_t generation;		// barriers passed, the waiting cores leave when it moves.
+	volatile uint32_t stopping;			// the core threads return at the next barrier.
+	int64_t slice;						// cycles each core runs before the next barrier.
+} multicore_t;
+
+multicore_t* multicore_load(simp_machine_t* machine);
+int run_lockstep(multicore_t* multicore, int64_t max_cycles);
+int run_multicore(multicore_t* multicore, int64_t max_cycles);
+void multicore_free(multicore_t* multicore);
+void lock_devices(multicore_t* multicore);
+void unlock_devices(multicore_t* multicore);
+
+#endif
@@ -0,0 +1,309 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "output.h"
+#include "trace_binary.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
+/*
+  description:
+	sequentially consistent access to the ring indices and the waiting flags. a thread about to sleep sets its flag
+	before it looks at the other thread's index a last time, and a thread moves its index before it looks at the
+	other's flag, so either the sleeper sees the new index or the other thread sees the flag. the other thread keeps
+	moving its index and wakes the sleeper once a batch is ready, so that neither side sleeps and wakes per record.
+	Interlocked functions are full barriers on every Windows target.
+
+*/
+#ifdef _WIN32
+typedef CRITICAL_SECTION ring_mutex_t;
+typedef CONDITION_VARIABLE ring_cond_t;
+static uint32_t load_sync(volatile uint32_t* p) { return (uint32_t)InterlockedCompareExchange((volatile LONG*)p, 0, 0); }
+static void store_sync(volatile uint32_t* p, uint32_t value) { InterlockedExchange((volatile LONG*)p, (LONG)value); }
+#else
+typedef pthread_mutex_t ring_mutex_t;
+typedef pthread_cond_t ring_cond_t;
+static uint32_t load_sync(volatile uint32_t* p) { return __atomic_load_n(p, __ATOMIC_SEQ_CST); }
+static void store_sync(volatile uint32_t* p, uint32_t value) { __atomic_store_n(p, value, __ATOMIC_SEQ_CST); }
+#endif
+
+struct output {
+	output_record_t records[OUTPUT_RING_SIZE];
+
+	volatile uint32_t head;				// next record to fill, written by the simulation thread only.
+	char pad0[64];
+	volatile uint32_t tail;				// next record to format, written by the writer thread only.
+	char pad1[64];
+
+	uint32_t cached_tail;				// simulation thread's view of tail, refreshed when the ring looks full.
+	simulator_t* sim;
+
+	volatile uint32_t writer_waiting;	// the writer thread sleeps on not_empty.
+	volatile uint32_t producer_waiting;	// the simulation thread sleeps on not_full.
+	ring_mutex_t mutex;
+	ring_cond_t not_empty;
+	ring_cond_t not_full;
+
+#ifdef _WIN32
+	HANDLE thread;
+#else
+	pthread_t thread;
+#endif
+};
+
+#ifdef _WIN32
+static void ring_init(output_t* output) { InitializeCriticalSection(&output->mutex); InitializeConditionVariable(&output->not_empty); InitializeConditionVariable(&output->not_full); }
+static void ring_destroy(output_t* output) { DeleteCriticalSection(&output->mutex); }
+static void ring_lock(output_t* output) { EnterCriticalSection(&output->mutex); }
+static void ring_unlock(output_t* output) { LeaveCriticalSection(&output->mutex); }
+static void ring_wait(output_t* output, ring_cond_t* cond) { SleepConditionVariableCS(cond, &output->mutex, INFINITE); }
+static void ring_signal(ring_cond_t* cond) { WakeConditionVariable(cond); }
+#else
+static void ring_init(output_t* output) { pthread_mutex_init(&output->mutex, NULL); pthread_cond_init(&output->not_empty, NULL); pthread_cond_init(&output->not_full, NULL); }
+static void ring_destroy(output_t* output) { pthread_cond_destroy(&output->not_full); pthread_cond_destroy(&output->not_empty); pthread_mutex_destroy(&output->mutex); }
+static void ring_lock(output_t* output) { pthread_mutex_lock(&output->mutex); }
+static void ring_unlock(output_t* output) { pthread_mutex_unlock(&output->mutex); }
+static void ring_wait(output_t* output, ring_cond_t* cond) { pthread_cond_wait(cond, &output->mutex); }
+static void ring_signal(ring_cond_t* cond) { pthread_cond_signal(cond); }
+#endif
+
+static void ring_wake(output_t* output, ring_cond_t* cond) {
+
+	ring_lock(output);
+	ring_signal(cond);
+	ring_unlock(output);
+}
+
+/*
+  description:
+	returns head once it differs from tail: polls OUTPUT_SPINS times, then sleeps until the simulation thread
+	committed OUTPUT_WAKE_BATCH records or stops. runs on the writer thread.
+
+*/
+static uint32_t wait_for_records(output_t* output, uint32_t tail) {
+
+	uint32_t head;
+
+	for (int spin = 0; spin < OUTPUT_SPINS; spin++) {
+
+		head = load_sync(&output->head);
+
+		if (head != tail) {
+			return head;
+		}
+	}
+
+	ring_lock(output);
+	store_sync(&output->writer_waiting, 1);
+
+	while ((head = load_sync(&output->head)) == tail) {
+		ring_wait(output, &output->not_empty);
+	}
+
+	store_sync(&output->writer_waiting, 0);
+	ring_unlock(output);
+
+	return head;
+}
+
+/*
+  description:
+	formats one record into the writer it belongs to. runs on the writer thread.
+
+*/
+static void format_record(simulator_t* sim, const output_record_t* record) {
+
+	int hw_info[3];
+
+	switch (record->kind) {
+
+	case OUTPUT_TRACE:
+
+		if (sim->trace_binary)
+			build_binary_trace(sim->trace, record->PC, record->R, sim->trace_previous);
+		else
+			build_trace(sim->trace, record->PC, sim->imem + record->PC * IMEM_LINE_SIZE, record->R, record->clock);
+		break;
+
+	case OUTPUT_HWREGTRACE:
+
+		hw_info[0] = record->io_register;
+		hw_info[1] = record->access;
+		hw_info[2] = record->value;
+		write_hwregtrace(&sim->hwregtrace_log, hw_info, record->clock);
+		break;
+
+	case OUTPUT_LEDS:
+
+		write_output(&sim->leds_log, record->clock, record->value);
+		break;
+
+	case OUTPUT_DISPLAY7SEG:
+
+		write_output(&sim->display7seg_log, record->clock, record->value);
+		break;
+	}
+}
+
+#ifdef _WIN32
+static DWORD WINAPI writer_thread(LPVOID argument) {
+#else
+static void* writer_thread(void* argument) {
+#endif
+
+	output_t* output = argument;
+	uint32_t tail = output->tail;
+	uint32_t head;
+
+	for (;;) {
+
+		head = wait_for_records(output, tail);
+
+		while (tail != head) {
+
+			const output_record_t* record = &output->records[tail & (OUTPUT_RING_SIZE - 1)];
+
+			if (record->kind == OUTPUT_STOP) {
+				store_sync(&output->tail, tail + 1);
+				return 0;
+			}
+
+			format_record(output->sim, record);
+			tail++;
+			store_sync(&output->tail, tail);
+
+			if (load_sync(&output->producer_waiting) && OUTPUT_RING_SIZE - (load_sync(&output->head) - tail) >= OUTPUT_WAKE_BATCH) {
+				ring_wake(output, &output->not_full);
+			}
+		}
+	}
+}
+
+output_t* output_start(simulator_t* sim) {
+
+	output_t* output = calloc_and_check(1, sizeof(output_t));
+
+	output->sim = sim;
+	ring_init(output);
+
+#ifdef _WIN32
+	output->thread = CreateThread(NULL, 0, writer_thread, output, 0, NULL);
+	if (output->thread == NULL) {
+#else
+	if (pthread_create(&output->thread, NULL, writer_thread, output) != 0) {
+#endif
+		printf("Thread creation error encountered\nTerminating program...");
+		exit(-1);
+	}
+
+	return output;
+}
+
+/*
+  description:
+	waits for the writer thread to free a record of the full ring. polls OUTPUT_SPINS times first, then sleeps until
+	OUTPUT_WAKE_BATCH records are free.
+
+*/
+static void wait_for_room(output_t* output, uint32_t head) {
+
+	for (int spin = 0; spin < OUTPUT_SPINS; spin++) {
+
+		output->cached_tail = load_sync(&output->tail);
+
+		if (head - output->cached_tail != OUTPUT_RING_SIZE) {
+			return;
+		}
+	}
+
+	ring_lock(output);
+	store_sync(&output->producer_waiting, 1);
+
+	while (head - (output->cached_tail = load_sync(&output->tail)) == OUTPUT_RING_SIZE) {
+		ring_wait(output, &output->not_full);
+	}
+
+	store_sync(&output->producer_waiting, 0);
+	ring_unlock(output);
+}
+
+/*
+  description:
+	returns the next free record, waiting for the writer thread while the ring is full.
+
+*/
+static output_record_t* reserve_record(output_t* output) {
+
+	uint32_t head = output->head;
+
+	if (head - output->cached_tail == OUTPUT_RING_SIZE) {
+		wait_for_room(output, head);
+	}
+
+	return &output->records[head & (OUTPUT_RING_SIZE - 1)];
+}
+
+static void commit_record(output_t* output) {
+
+	uint32_t head = output->head + 1;
+
+	store_sync(&output->head, head);
+
+	if (load_sync(&output->writer_waiting) && head - load_sync(&output->tail) >= OUTPUT_WAKE_BATCH) {
+		ring_wake(output, &output->not_empty);
+	}
+}
+
+void output_trace(output_t* output, uint32_t PC, int64_t clock, const int32_t R[NUM_OF_REGISTERS]) {
+
+	output_record_t* record = reserve_record(output);
+
+	record->kind = OUTPUT_TRACE;
+	record->PC = (uint16_t)PC;
+	record->clock = clock;
+	memcpy(record->R, R, sizeof(record->R));
+
+	commit_record(output);
+}
+
+void output_event(output_t* output, output_kind_t kind, int64_t clock, int32_t value, int io_register, int access) {
+
+	output_record_t* record = reserve_record(output);
+
+	record->kind = (uint8_t)kind;
+	record->io_register = (uint8_t)io_register;
+	record->access = (uint8_t)access;
+	record->clock = clock;
+	record->value = value;
+
+	commit_record(output);
+}
+
+/*
+  description:
+	drains the ring and joins the writer thread. the writers belong to the caller again afterwards.
+
+*/
+void output_stop(output_t* output) {
+
+	output_event(output, OUTPUT_STOP, 0, 0, 0, 0);
+
+	if (load_sync(&output->writer_waiting)) {      // whatever is left, fewer than OUTPUT_WAKE_BATCH records.
+		ring_wake(output, &output->not_empty);
+	}
+
+#ifdef _WIN32
+	WaitForSingleObject(output->thread, INFINITE);
+	CloseHandle(output->thread);
+#else
+	pthread_join(output->thread, NULL);
+#endif
+
+	ring_destroy(output);
+	free(output);
+}
@@ -0,0 +1,46 @@
+#ifndef __OUTPUT_H__
+#define __OUTPUT_H__
+
+#include "simulator.h"
+
+/*
+  description:
+	asynchronous output, selected with --async-output.
+
+	the simulation thread pushes fixed size records for trace rows, hwregtrace entries and leds/display7seg changes into a
+	lock-free single producer / single consumer ring. a writer thread formats them into the trace, hwregtrace, leds and
+	display7seg writers, which it owns until output_stop. the writer thread sleeps while the ring is empty and the
+	simulation thread only while it is full, each woken by the other once there is a record to format or room for one.
+
+*/
+
+#define OUTPUT_RING_SIZE 16384			// records, power of 2.
+#define OUTPUT_SPINS 256				// polls of an empty or full ring before the waiting thread sleeps.
+#define OUTPUT_WAKE_BATCH 1024			// records to format, or free ones, before a sleeping thread is woken.
+
+typedef enum {
+	OUTPUT_TRACE,
+	OUTPUT_HWREGTRACE,
+	OUTPUT_LEDS,
+	OUTPUT_DISPLAY7SEG,
+	OUTPUT_STOP
+} output_kind_t;
+
+typedef struct {
+	uint8_t kind;
+	uint8_t io_register;				// hwregtrace register index.
+	uint8_t access;						// hwregtrace: 1 for READ / 2 for WRITE.
+	uint16_t PC;
+	int64_t clock;
+	int32_t value;						// hwregtrace, leds and display7seg value.
+	int32_t R[NUM_OF_REGISTERS];		// trace rows only.
+} output_record_t;
+
+typedef struct output output_t;
+
+output_t* output_start(simulator_t* sim);
+void output_trace(output_t* output, uint32_t PC, int64_t clock, const int32_t R[NUM_OF_REGISTERS]);
+void output_event(output_t* output, output_kind_t kind, int64_t clock, int32_t value, int io_register, int access);
+void output_stop(output_t* output);
+
+#endif
@@ -0,0 +1,585 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "profile.h"
+#include "stats.h"
+
+static int symbol_compare(const void* a, const void* b) {
+
+	const symbol_t* first = a;
+	const symbol_t* second = b;
+
+	if (first->address != second->address) {
+		return first->address < second->address ? -1 : 1;
+	}
+
+	return strcmp(first->name, second->name);
+}
+
+/*
+  description:
+	reads the symbol map, a label per line: its address in hex, then its name. NULL or an empty file for none.
+
+*/
+static void read_symbols(profile_t* profile, char* symbols_fname) {
+
+	FILE* fptr;
+	char line[SYMBOL_LINE_SIZE];
+	int capacity = 64;
+	int line_number = 0;
+
+	if (symbols_fname == NULL) {
+		return;
+	}
+
+	fopen_s(&fptr, symbols_fname, "r");
+
+	if (fptr == NULL) {
+		printf("IO error encountered\nTerminating program...");
+		exit(-1);
+	}
+
+	profile->symbols = calloc_and_check(capacity, sizeof(symbol_t));
+
+	while (fgets(line, sizeof(line), fptr) != NULL) {
+
+		char* start = line;
+		char* name;
+		char* end;
+		size_t length;
+		uint32_t address;
+
+		line_number++;
+
+		while (*start == ' ' || *start == '\t') {
+			start++;
+		}
+
+		if (*start == '\0' || *start == '\n' || *start == '\r') {
+			continue;     // empty line.
+		}
+
+		address = (uint32_t)strtoul(start, &name, 16);
+
+		while (*name == ' ' || *name == '\t') {
+			name++;
+		}
+
+		for (end = name; *end != '\0' && *end != '\n' && *end != '\r' && *end != ' ' && *end != '\t'; end++);
+		length = end - name;
+
+		if (name == start || length == 0) {
+			printf("Invalid symbol map line %d, expected address label\nTerminating program...", line_number);
+			exit(-1);
+		}
+
+		if (profile->num_of_symbols == capacity) {
+
+			symbol_t* temp_buffer = realloc(profile->symbols, 2 * capacity * sizeof(symbol_t));
+
+			if (temp_buffer == NULL) {
+				printf("Memory assignment error encountered\nTerminating program...");
+				exit(-1);
+			}
+
+			profile->symbols = temp_buffer;
+			capacity *= 2;
+		}
+
+		profile->symbols[profile->num_of_symbols].address = address & PC_MASK;
+		profile->symbols[profile->num_of_symbols].name = calloc_and_check(length + 1, sizeof(char));
+		memcpy(profile->symbols[profile->num_of_symbols].name, name, length);
+		profile->num_of_symbols++;
+	}
+
+	fclose(fptr);
+
+	qsort(profile->symbols, profile->num_of_symbols, sizeof(symbol_t), symbol_compare);
+}
+
+/*
+  description:
+	child of node running function, created on the first call through this path.
+
+*/
+static int call_node(profile_t* profile, int parent, uint32_t function) {
+
+	int node;
+
+	for (node = parent >= 0 ? profile->nodes[parent].first_child : -1; node >= 0; node = profile->nodes[node].next_sibling) {
+		if (profile->nodes[node].function == function) {
+			return node;
+		}
+	}
+
+	if (profile->num_of_nodes == profile->nodes_capacity) {
+
+		call_node_t* temp_buffer = realloc(profile->nodes, 2 * (size_t)profile->nodes_capacity * sizeof(call_node_t));
+
+		if (temp_buffer == NULL) {
+			printf("Memory assignment error encountered\nTerminating program...");
+			exit(-1);
+		}
+
+		profile->nodes = temp_buffer;
+		profile->nodes_capacity *= 2;
+	}
+
+	node = profile->num_of_nodes++;
+	memset(&profile->nodes[node], 0, sizeof(call_node_t));
+	profile->nodes[node].function = function;
+	profile->nodes[node].parent = parent;
+	profile->nodes[node].first_child = -1;
+	profile->nodes[node].next_sibling = -1;
+
+	if (parent >= 0) {
+		profile->nodes[node].next_sibling = profile->nodes[parent].first_child;
+		profile->nodes[parent].first_child = node;
+	}
+
+	return node;
+}
+
+/*
+  description:
+	starts the call graph at entry, the PC the machine runs from.
+
+*/
+profile_t* profile_open(char* symbols_fname, uint32_t entry) {
+
+	profile_t* profile = calloc_and_check(1, sizeof(profile_t));
+
+	read_symbols(profile, symbols_fname);
+
+	profile->nodes_capacity = 64;
+	profile->nodes = calloc_and_check(profile->nodes_capacity, sizeof(call_node_t));
+	profile->frames[0].node = call_node(profile, -1, entry);
+	profile->frames[0].link = -1;
+	profile->depth = 1;
+
+	return profile;
+}
+
+static void call(profile_t* profile, uint32_t function, int link) {
+
+	if (profile->depth == PROFILE_MAX_DEPTH) {
+		profile->lost_frames++;
+		return;
+	}
+
+	call_frame_t* frame = &profile->frames[profile->depth++];
+
+	frame->node = call_node(profile, profile->frames[profile->depth - 2].node, function);
+	frame->link = link;
+	profile->nodes[frame->node].calls++;
+}
+
+/*
+  description:
+	follows the shadow call stack through an instruction whose cycle was counted, target being the PC it set: jal calls, a taken branch to the return
+	address register returns, reti returns from the interrupt handler and from whatever it called without returning.
+
+*/
+static void follow_calls(profile_t* profile, const decoded_instruction_t* inst, uint32_t target, int branched) {
+
+	call_frame_t* top = &profile->frames[profile->depth - 1];
+
+	if (inst->opcode == 15) {      // jal
+
+		if (inst->rd > 2) {        // the return address was saved, a jal to $zero is a plain jump.
+			call(profile, target, inst->rd);
+		}
+	}
+	else if (inst->opcode >= 9 && inst->opcode <= 14) {     // branches
+
+		if (branched && inst->rm == top->link) {
+
+			if (profile->lost_frames > 0) {
+				profile->lost_frames--;
+			}
+			else if (profile->depth > 1) {
+				profile->depth--;
+			}
+		}
+	}
+	else if (inst->opcode == 18) {       // reti
+
+		int depth = profile->depth;
+
+		while (depth > 1 && profile->frames[depth - 1].link != -1) {
+			depth--;
+		}
+
+		if (depth > 1) {
+			profile->depth = depth - 1;
+			profile->lost_frames = 0;
+		}
+	}
+}
+
+/*
+  description:
+	the switch interpreter's loop, counting each cycle against the instruction it ran and the function running it,
+	and in the --stats counters when they are on.
+	begin_cycle may have entered the irq handler, so the address is taken from the instruction it returns.
+
+*/
+void run_profiled(simulator_t* sim) {
+
+	profile_t* profile = sim->profile;
+	const decoded_instruction_t* inst;
+	int done;
+
+	do {
+
+		int64_t clock = sim->clock;
+		int in_handler = sim->state.irq_subroutine_flag;
+		int branched;
+		uint32_t PC, target, cycles;
+
+		inst = begin_cycle(sim);
+		PC = (uint32_t)(inst - sim->decoded_imem);
+
+		if (!in_handler && sim->state.irq_subroutine_flag) {
+
+			call(profile, PC, -1);       // the interrupt was taken.
+
+			if (sim->stats != NULL) {
+				count_interrupt(sim->stats, &sim->state);
+			}
+		}
+
+		in_handler = sim->state.irq_subroutine_flag;
+
+		execute_instruction(inst, &sim->state);
+		branched = sim->state.PC_set_flag;
+		target = sim->state.PC;
+
+		done = end_cycle(sim);
+		cycles = (uint32_t)(sim->clock - clock);     // more than 1 when fast-forward skipped a loop.
+
+		profile->executions[PC]++;
+		profile->cycles[PC] += cycles;
+		profile->nodes[profile->frames[profile->depth - 1].node].cycles += cycles;     // the caller's cycle for jal, the callee's for a return.
+
+		if (sim->stats != NULL) {
+			count_instruction(sim->stats, &sim->state, inst, in_handler, branched, cycles);
+		}
+
+		if (inst->opcode == 15 || (inst->opcode >= 9 && inst->opcode <= 14) || inst->opcode == 18) {
+			follow_calls(profile, inst, target, branched);
+		}
+
+	} while (!done);
+}
+
+/*
+  description:
+	index of the symbol an address belongs to, the last one at or before it, -1 before the first.
+
+*/
+static int owner_symbol(const profile_t* profile, uint32_t address) {
+
+	int low = 0, high = profile->num_of_symbols - 1, owner = -1;
+
+	while (low <= high) {
+
+		int middle = (low + high) / 2;
+
+		if (profile->symbols[middle].address <= address) {
+			owner = middle;
+			low = middle + 1;
+		}
+		else {
+			high = middle - 1;
+		}
+	}
+
+	return owner;
+}
+
+/*
+  description:
+	an address as the report prints it: its label, label+offset past the closest one before it, or its hex value.
+
+*/
+static void address_name(const profile_t* profile, uint32_t address, char* name, size_t size) {
+
+	int symbol = owner_symbol(profile, address);
+
+	if (symbol < 0) {
+		sprintf_s(name, size, "%03X", address);
+	}
+	else if (profile->symbols[symbol].address == address) {
+		sprintf_s(name, size, "%s", profile->symbols[symbol].name);
+	}
+	else {
+		sprintf_s(name, size, "%s+%u", profile->symbols[symbol].name, address - profile->symbols[symbol].address);
+	}
+}
+
+typedef struct {
+	uint32_t address;
+	uint64_t cycles;
+} hot_spot_t;
+
+static int hot_spot_compare(const void* a, const void* b) {
+
+	const hot_spot_t* first = a;
+	const hot_spot_t* second = b;
+
+	if (first->cycles != second->cycles) {
+		return first->cycles > second->cycles ? -1 : 1;
+	}
+
+	return first->address < second->address ? -1 : 1;
+}
+
+typedef struct {
+	int symbol;
+	uint64_t cycles;
+	uint64_t executions;
+} label_total_t;
+
+static int label_compare(const void* a, const void* b) {
+
+	const label_total_t* first = a;
+	const label_total_t* second = b;
+
+	if (first->cycles != second->cycles) {
+		return first->cycles > second->cycles ? -1 : 1;
+	}
+
+	return first->symbol < second->symbol ? -1 : 1;
+}
+
+typedef struct {
+	uint32_t address;
+	int seen;
+	uint64_t inclusive;
+	uint64_t exclusive;
+	uint64_t calls;
+} function_total_t;
+
+static int function_compare(const void* a, const void* b) {
+
+	const function_total_t* first = a;
+	const function_total_t* second = b;
+
+	if (first->inclusive != second->inclusive) {
+		return first->inclusive > second->inclusive ? -1 : 1;
+	}
+
+	return first->address < second->address ? -1 : 1;
+}
+
+static double percent(uint64_t part, uint64_t total) {
+
+	return total != 0 ? 100.0 * (double)part / (double)total : 0;
+}
+
+/*
+  description:
+	writes the function table of the call graph, by inclusive cycles.
+
+*/
+static void write_functions(const profile_t* profile, FILE* fptr, uint64_t total_cycles) {
+
+	uint64_t* subtree = calloc_and_check(profile->num_of_nodes, sizeof(uint64_t));
+	function_total_t* functions = calloc_and_check(MEM_SIZE, sizeof(function_total_t));
+	int num_of_functions = 0;
+	int node, i;
+
+	for (node = profile->num_of_nodes - 1; node >= 0; node--) {     // a node's children come after it.
+
+		subtree[node] += profile->nodes[node].cycles;
+
+		if (profile->nodes[node].parent >= 0) {
+			subtree[profile->nodes[node].parent] += subtree[node];
+		}
+	}
+
+	for (node = 0; node < profile->num_of_nodes; node++) {
+
+		const call_node_t* call = &profile->nodes[node];
+		function_total_t* function = &functions[call->function];
+		int ancestor = call->parent;
+
+		while (ancestor >= 0 && profile->nodes[ancestor].function != call->function) {
+			ancestor = profile->nodes[ancestor].parent;
+		}
+
+		if (ancestor < 0) {
+			function->inclusive += subtree[node];     // recursive calls are inside the outermost one.
+		}
+
+		function->address = call->function;
+		function->exclusive += call->cycles;
+		function->calls += call->calls;
+		function->seen = 1;
+	}
+
+	for (i = 0; i < MEM_SIZE; i++) {
+		if (functions[i].seen) {
+			functions[num_of_functions++] = functions[i];
+		}
+	}
+
+	qsort(functions, num_of_functions, sizeof(function_total_t), function_compare);
+
+	fprintf(fptr, "\n%14s %8s %14s %8s %14s  %s\n", "inclusive", "%", "exclusive", "%", "calls", "function");
+
+	for (i = 0; i < num_of_functions; i++) {
+
+		char name[SYMBOL_LINE_SIZE + 16];
+
+		address_name(profile, functions[i].address, name, sizeof(name));
+		fprintf(fptr, "%14llu %7.2f%% %14llu %7.2f%% %14llu  %s\n", (unsigned long long)functions[i].inclusive,
+				percent(functions[i].inclusive, total_cycles), (unsigned long long)functions[i].exclusive,
+				percent(functions[i].exclusive, total_cycles), (unsigned long long)functions[i].calls, name);
+	}
+
+	free(subtree);
+	free(functions);
+}
+
+/*
+  description:
+	writes the hot spot report: the totals, every executed address by cycles, hottest first, with its label and
+	instruction, then the labels by cycles, then the functions by inclusive cycles. addresses before the first label
+	count as "-" among the labels.
+
+*/
+void write_profile(const profile_t* profile, const char* imem, char* fname) {
+
+	FILE* fptr;
+	hot_spot_t* hot_spots = calloc_and_check(MEM_SIZE, sizeof(hot_spot_t));
+	label_total_t* labels = calloc_and_check((size_t)profile->num_of_symbols + 1, sizeof(label_total_t));
+	uint64_t total_cycles = 0, total_executions = 0;
+	int num_of_hot_spots = 0;
+	int num_of_labels = 0;
+	int i;
+
+	for (i = 0; i <= profile->num_of_symbols; i++) {
+		labels[i].symbol = i - 1;     // labels[0] holds the addresses before the first label.
+	}
+
+	for (uint32_t address = 0; address < MEM_SIZE; address++) {
+
+		if (profile->executions[address] == 0 && profile->cycles[address] == 0) {
+			continue;
+		}
+
+		label_total_t* label = &labels[owner_symbol(profile, address) + 1];
+
+		label->cycles += profile->cycles[address];
+		label->executions += profile->executions[address];
+		total_cycles += profile->cycles[address];
+		total_executions += profile->executions[address];
+		hot_spots[num_of_hot_spots].address = address;
+		hot_spots[num_of_hot_spots].cycles = profile->cycles[address];
+		num_of_hot_spots++;
+	}
+
+	qsort(hot_spots, num_of_hot_spots, sizeof(hot_spot_t), hot_spot_compare);
+
+	for (i = 0; i <= profile->num_of_symbols; i++) {
+		if (labels[i].executions != 0 || labels[i].cycles != 0) {
+			labels[num_of_labels++] = labels[i];
+		}
+	}
+
+	qsort(labels, num_of_labels, sizeof(label_total_t), label_compare);
+
+	fopen_s(&fptr, fname, "w");
+
+	if (fptr == NULL) {
+		printf("IO error encountered\nTerminating program...");
+		exit(-1);
+	}
+
+	fprintf(fptr, "%llu cycles, %llu instructions executed\n\n", (unsigned long long)total_cycles, (unsigned long long)total_executions);
+	fprintf(fptr, "%14s %8s %14s  %-3s  %-24s %s\n", "cycles", "%", "executions", "PC", "label", "instruction");
+
+	for (i = 0; i < num_of_hot_spots; i++) {
+
+		uint32_t address = hot_spots[i].address;
+		char location[SYMBOL_LINE_SIZE + 16];
+
+		address_name(profile, address, location, sizeof(location));
+
+		fprintf(fptr, "%14llu %7.2f%% %14llu  %03X  %-24s %.*s\n", (unsigned long long)profile->cycles[address],
+				percent(profile->cycles[address], total_cycles), (unsigned long long)profile->executions[address], address,
+				location, IMEM_LINE_SIZE, imem + (size_t)address * IMEM_LINE_SIZE);
+	}
+
+	fprintf(fptr, "\n%14s %8s %14s  %s\n", "cycles", "%", "executions", "label");
+
+	for (i = 0; i < num_of_labels; i++) {
+
+		fprintf(fptr, "%14llu %7.2f%% %14llu  %s\n", (unsigned long long)labels[i].cycles, percent(labels[i].cycles, total_cycles),
+				(unsigned long long)labels[i].executions, labels[i].symbol >= 0 ? profile->symbols[labels[i].symbol].name : "-");
+	}
+
+	write_functions(profile, fptr, total_cycles);
+
+	fclose(fptr);
+	free(hot_spots);
+	free(labels);
+}
+
+/*
+  description:
+	writes the calling context tree as collapsed stacks: a line per call path that ran cycles of its own, the
+	functions from the outermost one separated by ';', then the cycles.
+
+*/
+void write_stacks(const profile_t* profile, char* fname) {
+
+	FILE* fptr;
+	int path[PROFILE_MAX_DEPTH];
+
+	fopen_s(&fptr, fname, "w");
+
+	if (fptr == NULL) {
+		printf("IO error encountered\nTerminating program...");
+		exit(-1);
+	}
+
+	for (int node = 0; node < profile->num_of_nodes; node++) {
+
+		int depth = 0;
+
+		if (profile->nodes[node].cycles == 0) {
+			continue;
+		}
+
+		for (int ancestor = node; ancestor >= 0; ancestor = profile->nodes[ancestor].parent) {
+			path[depth++] = ancestor;
+		}
+
+		while (depth-- > 0) {
+
+			char name[SYMBOL_LINE_SIZE + 16];
+
+			address_name(profile, profile->nodes[path[depth]].function, name, sizeof(name));
+			fprintf(fptr, depth > 0 ? "%s;" : "%s", name);
+		}
+
+		fprintf(fptr, " %llu\n", (unsigned long long)profile->nodes[node].cycles);
+	}
+
+	fclose(fptr);
+}
+
+void profile_free(profile_t* profile) {
+
+	for (int i = 0; i < profile->num_of_symbols; i++) {
+		free(profile->symbols[i].name);
+	}
+
+	free(profile->symbols);
+	free(profile->nodes);
+	free(profile);
+}
@@ -0,0 +1,75 @@
+#ifndef __PROFILE_H__
+#define __PROFILE_H__
+
+#include "simulator.h"
+
+/*
+  description:
+	execution profile, selected with --profile=FILE. every cycle is counted against the imem address of the
+	instruction it ran, in flat arrays indexed by PC. cycles that --fast-forward skips count against the instruction
+	that closed the skipped loop pass, so the cycles add up to cycles.txt while executions only count what ran.
+
+	--symbols=FILE names the addresses after the assembler's symbol map (Assembler prog.asm imemin.txt dmemin.txt
+	symbols.txt), an address belonging to the closest label at or before it. the report, written by simp_dump, lists
+	the executed addresses hottest first, then the cycles of each label, then the functions of the call graph.
+
+	the call graph follows a shadow call stack: jal calls the function at its target and a taken branch to the
+	register jal saved the return address in returns from it. taking an interrupt calls the handler, reti returns from
+	it. cycles go to the calling context tree node of the running function, so each function gets its exclusive
+	cycles, and inclusive ones that count a recursive function once. --stacks=FILE writes the tree as collapsed
+	stacks, a "caller;callee cycles" line per call path, the input of flamegraph.pl.
+
+	a profiled machine runs on run_profiled, a counting copy of the switch interpreter's loop, whatever the engine.
+	the engines themselves are untouched, so they run as fast as ever without a profile.
+
+*/
+
+#define SYMBOL_LINE_SIZE 512
+#define PROFILE_MAX_DEPTH 256			// call frames followed, deeper calls count against the deepest one.
+
+typedef struct {
+	uint32_t address;
+	char* name;
+} symbol_t;
+
+/*
+  description:
+	calling context tree node: a function reached through one call path.
+
+*/
+typedef struct {
+	uint32_t function;						// entry address.
+	int parent;
+	int first_child;
+	int next_sibling;
+	uint64_t cycles;						// spent in the function itself on this path.
+	uint64_t calls;
+} call_node_t;
+
+typedef struct {
+	int node;
+	int link;								// register jal saved the return address in, -1 for an interrupt handler.
+} call_frame_t;
+
+typedef struct profile {
+	uint64_t executions[MEM_SIZE];
+	uint64_t cycles[MEM_SIZE];
+
+	symbol_t* symbols;						// sorted by address.
+	int num_of_symbols;
+
+	call_node_t* nodes;						// nodes[0] is the code running when profiling started.
+	int num_of_nodes;
+	int nodes_capacity;
+	call_frame_t frames[PROFILE_MAX_DEPTH];	// shadow call stack, frames[0] never returns.
+	int depth;
+	int lost_frames;						// calls made past PROFILE_MAX_DEPTH and not returned from yet.
+} profile_t;
+
+profile_t* profile_open(char* symbols_fname, uint32_t entry);
+void run_profiled(simulator_t* sim);
+void write_profile(const profile_t* profile, const char* imem, char* fname);
+void write_stacks(const profile_t* profile, char* fname);
+void profile_free(profile_t* profile);
+
+#endif
@@ -0,0 +1,127 @@
+#include "scheduler.h"
+
+static void swap_events(scheduler_t* scheduler, int i, int j) {
+
+	event_t temp = scheduler->heap[i];
+
+	scheduler->heap[i] = scheduler->heap[j];
+	scheduler->heap[j] = temp;
+
+	scheduler->position[scheduler->heap[i].kind] = i;
+	scheduler->position[scheduler->heap[j].kind] = j;
+}
+
+/*
+  description:
+	heap order: by clock, then by kind, so events due at the same clock are serviced in the order of event_kind_t.
+
+*/
+static int earlier(const event_t* a, const event_t* b) {
+
+	return a->clock < b->clock || (a->clock == b->clock && a->kind < b->kind);
+}
+
+static void sift_up(scheduler_t* scheduler, int i) {
+
+	while (i > 0 && earlier(&scheduler->heap[i], &scheduler->heap[(i - 1) / 2])) {
+
+		swap_events(scheduler, i, (i - 1) / 2);
+		i = (i - 1) / 2;
+	}
+}
+
+static void sift_down(scheduler_t* scheduler, int i) {
+
+	for (;;) {
+
+		int smallest = i;
+		int left = 2 * i + 1;
+		int right = 2 * i + 2;
+
+		if (left < scheduler->size && earlier(&scheduler->heap[left], &scheduler->heap[smallest])) smallest = left;
+		if (right < scheduler->size && earlier(&scheduler->heap[right], &scheduler->heap[smallest])) smallest = right;
+
+		if (smallest == i) {
+			return;
+		}
+
+		swap_events(scheduler, i, smallest);
+		i = smallest;
+	}
+}
+
+void scheduler_init(scheduler_t* scheduler) {
+
+	int kind;
+
+	scheduler->size = 0;
+
+	for (kind = 0; kind < NUM_OF_EVENTS; kind++) {
+		scheduler->position[kind] = -1;
+	}
+}
+
+/*
+  description:
+	schedules kind at clock, moving it if it was already scheduled. NEVER cancels it.
+
+*/
+void schedule_event(scheduler_t* scheduler, int kind, int64_t clock) {
+
+	int i = scheduler->position[kind];
+
+	if (clock == NEVER) {
+		cancel_event(scheduler, kind);
+		return;
+	}
+
+	if (i < 0) {
+
+		i = scheduler->size++;
+		scheduler->heap[i].kind = kind;
+		scheduler->position[kind] = i;
+	}
+
+	scheduler->heap[i].clock = clock;
+	sift_up(scheduler, i);
+	sift_down(scheduler, scheduler->position[kind]);
+}
+
+void cancel_event(scheduler_t* scheduler, int kind) {
+
+	int i = scheduler->position[kind];
+
+	if (i < 0) {
+		return;
+	}
+
+	scheduler->size--;
+	scheduler->position[kind] = -1;
+
+	if (i != scheduler->size) {
+
+		scheduler->heap[i] = scheduler->heap[scheduler->size];
+		scheduler->position[scheduler->heap[i].kind] = i;
+		sift_up(scheduler, i);
+		sift_down(scheduler, scheduler->position[scheduler->heap[i].kind]);
+	}
+}
+
+/*
+  description:
+	removes and returns the earliest event due at or before clock, -1 if there is none.
+
+*/
+int pop_due_event(scheduler_t* scheduler, int64_t clock) {
+
+	int kind;
+
+	if (scheduler->size == 0 || scheduler->heap[0].clock > clock) {
+		return -1;
+	}
+
+	kind = scheduler->heap[0].kind;
+	cancel_event(scheduler, kind);
+
+	return kind;
+}
@@ -0,0 +1,44 @@
+#ifndef __SCHEDULER_H__
+#define __SCHEDULER_H__
+
+#include <stdint.h>
+
+#define NEVER INT64_MAX
+
+/*
+  description:
+	peripheral events, kept in a min-heap keyed by the clock at whose start they take effect.
+	each kind is scheduled at most once, rescheduling moves it. events due at the same clock pop in kind order.
+
+*/
+typedef enum {
+	EVENT_CHECKPOINT,	// periodic or requested checkpoint, taken before anything else due at the same clock.
+	EVENT_TIMER,		// timercurrent reaches timermax.
+	EVENT_IRQ2,			// next irq2 edge from irq2in.
+	EVENT_DISK,			// disk command completes.
+	EVENT_RUN_LIMIT,	// last cycle of a bounded run, nothing to service: it keeps quiet cycles from running past it.
+	NUM_OF_EVENTS
+} event_kind_t;
+
+typedef struct {
+	int64_t clock;
+	int kind;
+} event_t;
+
+typedef struct {
+	event_t heap[NUM_OF_EVENTS];
+	int position[NUM_OF_EVENTS];		// heap index of each kind, -1 when it isn't scheduled.
+	int size;
+} scheduler_t;
+
+void scheduler_init(scheduler_t* scheduler);
+void schedule_event(scheduler_t* scheduler, int kind, int64_t clock);
+void cancel_event(scheduler_t* scheduler, int kind);
+int pop_due_event(scheduler_t* scheduler, int64_t clock);
+
+static inline int64_t next_event_clock(const scheduler_t* scheduler) {
+
+	return scheduler->size != 0 ? scheduler->heap[0].clock : NEVER;
+}
+
+#endif
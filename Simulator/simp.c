@@ -0,0 +1,387 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "simp.h"
+#include "jit.h"
+#include "aot.h"
+#include "trace_binary.h"
+#include "output.h"
+#include "checkpoint.h"
+#include "multicore.h"
+#include "profile.h"
+#include "stats.h"
+#include "loader.h"
+#include "log.h"
+
+void simp_default_config(simp_config_t* config) {
+
+	memset(config, 0, sizeof(simp_config_t));
+	config->engine = ENGINE_SWITCH;
+	config->disk_sectors = DISK_SECTORS;
+	config->cores = 1;
+}
+
+/*
+  description:
+	settles the options against what this build supports, with a warning for each one it changes: an engine that
+	isn't available falls back to the threaded one, and a multi-core machine neither skips idle loops, which other
+	cores could end, nor picks its engine in lockstep. simp_load settles its own copy, a caller loading many machines
+	from the same options can settle them once beforehand.
+
+*/
+void simp_check_config(simp_config_t* config) {
+
+	if (config->fast_forward && LOG_DEBUG_ENABLED) {
+		LOG_WARNING("--fast-forward is ignored with --log=debug, every cycle is dumped.\n");
+		config->fast_forward = 0;
+	}
+
+	if (config->cores > 1 && config->fast_forward) {
+		LOG_WARNING("--fast-forward is ignored with --cores, another core can end an idle loop.\n");
+		config->fast_forward = 0;
+	}
+
+	if (config->cores > 1 && config->quantum == 0 && config->engine != ENGINE_SWITCH) {
+		LOG_WARNING("--engine is ignored in lockstep, the cores interleave every cycle on the switch interpreter.\n");
+		config->engine = ENGINE_SWITCH;
+	}
+
+	if (config->profile != NULL && config->engine != ENGINE_SWITCH) {
+		LOG_WARNING("--engine is ignored with --profile, every cycle is counted on the switch interpreter.\n");
+		config->engine = ENGINE_SWITCH;
+	}
+
+	if (config->stats != NULL && config->engine != ENGINE_SWITCH) {
+		LOG_WARNING("--engine is ignored with --stats, every instruction is counted on the switch interpreter.\n");
+		config->engine = ENGINE_SWITCH;
+	}
+
+	if (config->stats != NULL && config->fast_forward) {
+		LOG_WARNING("--fast-forward is ignored with --stats, the skipped instructions would go uncounted.\n");
+		config->fast_forward = 0;
+	}
+
+	if (config->engine == ENGINE_JIT && !jit_available()) {
+		LOG_WARNING("JIT is not available on this platform, using the threaded engine.\n");
+		config->engine = ENGINE_THREADED;
+	}
+
+#ifndef SIMP_AOT
+	if (config->engine == ENGINE_AOT) {
+		LOG_WARNING("No translated program was linked in, using the threaded engine.\n");
+		config->engine = ENGINE_THREADED;
+	}
+#endif
+}
+
+/*
+  description:
+	loads a machine from the input files, or from config->restore, ready to run its first cycle.
+
+*/
+simp_machine_t* simp_load(const simp_config_t* config) {
+
+	simp_machine_t* machine = calloc_and_check(1, sizeof(simp_machine_t));     // registers, IO registers and PC start at 0.
+	simulator_t* sim = &machine->sim;
+	const simp_inputs_t* inputs;
+
+	machine->config = *config;
+	simp_check_config(&machine->config);
+
+	config = &machine->config;
+	inputs = config->inputs;
+
+	if (inputs != NULL && inputs->imem != NULL) {
+		sim->imem = inputs->imem;
+		sim->decoded_imem = inputs->decoded_imem;
+	}
+	else {
+		sim->imem = readfile(config->imemin, IMEM_LINE_SIZE, MEM_SIZE);  // contains data in sequence, imemin[ i * data_size] for the i+1 line start address.
+		sim->decoded_imem = predecode_imem(sim->imem, config->engine);
+	}
+
+	if (inputs != NULL && inputs->dmem != NULL) {
+		sim->state.dmem = calloc_and_check(MEM_SIZE, sizeof(uint32_t));
+		memcpy(sim->state.dmem, inputs->dmem, MEM_SIZE * sizeof(uint32_t));
+	}
+	else {
+		sim->state.dmem = read_memory_image(config->dmemin, DMEM_LINE_SIZE, MEM_SIZE);  // binary word images, dmem[i] holds the i+1 line.
+	}
+
+	disk_open(&machine->disk, config->diskin, config->disk_sectors);     // sectors are parsed when a disk command first transfers them.
+	sim->disk = &machine->disk;
+
+	sim->trace_enabled = config->trace != NULL;
+	sim->trace_binary = config->trace_binary;
+	sim->fast_forward = config->fast_forward;
+	sim->checkpoint_fname = config->checkpoint;
+	sim->checkpoint_every = config->checkpoint_every;
+
+	if (config->restore == NULL && sim->trace_enabled) {
+
+		sim->trace = writer_open(config->trace, WRITER_BUFFER_SIZE, sim->trace_binary);
+
+		if (sim->trace_binary) {
+			write_binary_trace_header(sim->trace, sim->imem);
+		}
+	}
+
+	sim->monitor = calloc_and_check(MONITOR_PIXELS * (MONITOR_LINE_SIZE + 1), sizeof(char));     // monitor.txt as written, a line per pixel.
+
+	for (int pixel = 0; pixel < MONITOR_PIXELS; pixel++) {
+		memcpy(sim->monitor + pixel * (MONITOR_LINE_SIZE + 1), "00\n", MONITOR_LINE_SIZE + 1);
+	}
+
+	sim->monitor_hex = calloc_and_check(MONITOR_PIXELS, sizeof(char));
+
+	if (inputs != NULL && inputs->irq2_up_clocks != NULL) {
+		sim->irq2_up_clocks = inputs->irq2_up_clocks;
+		sim->num_irq2_up_clocks = inputs->num_irq2_up_clocks;
+	}
+	else {
+		sim->irq2_up_clocks = readirq2(config->irq2in, &sim->num_irq2_up_clocks);   // clock cycles during which irq2status = 1;
+	}
+
+	event_log_init(&sim->hwregtrace_log, config->hwregtrace);
+	event_log_init(&sim->leds_log, config->leds);
+	event_log_init(&sim->display7seg_log, config->display7seg);
+
+	if (config->restore != NULL) {
+		restore_checkpoint(sim, config->restore, config->trace);     // carries on from the checkpoint, trace and logs included.
+	}
+
+	checkpoint_init(sim);
+
+	if (config->profile != NULL) {
+		sim->profile = profile_open(config->symbols, sim->state.PC);
+	}
+
+	if (config->stats != NULL) {
+		sim->stats = stats_open(&sim->state);     // from the counter registers of a restored machine.
+	}
+
+	if (config->async_output) {
+		sim->output = output_start(sim);
+	}
+
+	init_events(sim);
+
+	if (config->cores > 1) {
+		machine->multicore = multicore_load(machine);
+	}
+
+	return machine;
+}
+
+/*
+  description:
+	runs engine on a core until it halts or max_cycles clock cycles have gone by. the limit is the clock at which
+	end_cycle stops, and its last cycle is a scheduled event, so that no engine runs quiet cycles past it.
+
+*/
+int run_engine(simulator_t* sim, engine_t engine, int64_t max_cycles) {
+
+	if (sim->state.halt_flag) {
+		return SIMP_HALTED;
+	}
+
+	if (max_cycles <= 0) {
+		return SIMP_RUNNING;
+	}
+
+	sim->run_limit = max_cycles < NEVER - sim->clock ? sim->clock + max_cycles : NEVER;
+	schedule_event(&sim->events, EVENT_RUN_LIMIT, sim->run_limit != NEVER ? sim->run_limit - 1 : NEVER);
+
+	if (sim->profile != NULL) {
+		run_profiled(sim);
+	}
+	else if (sim->stats != NULL) {
+		run_counted(sim);
+	}
+	else if (engine == ENGINE_JIT) {
+		run_jit(sim);
+	}
+#ifdef SIMP_AOT
+	else if (engine == ENGINE_AOT) {
+		run_aot(sim);
+	}
+#endif
+	else if (engine == ENGINE_THREADED) {
+		run_threaded(sim);
+	}
+	else {
+		run_switch(sim);
+	}
+
+	return sim->state.halt_flag ? SIMP_HALTED : SIMP_RUNNING;
+}
+
+/*
+  description:
+	runs a single clock cycle on the switch interpreter, whatever the engine, of every core.
+	returns SIMP_HALTED once the machine halted, SIMP_RUNNING otherwise.
+
+*/
+int simp_step(simp_machine_t* machine) {
+
+	if (machine->multicore != NULL) {
+		return run_lockstep(machine->multicore, 1);
+	}
+
+	return run_engine(&machine->sim, ENGINE_SWITCH, 1);
+}
+
+/*
+  description:
+	runs the machine's engine for up to max_cycles clock cycles, SIMP_NO_LIMIT to run until halt. a machine that
+	stopped at the limit carries on from the same cycle on the next call.
+	returns SIMP_HALTED once the machine halted, SIMP_RUNNING otherwise.
+
+*/
+int simp_run(simp_machine_t* machine, int64_t max_cycles) {
+
+	if (machine->multicore != NULL) {
+		return run_multicore(machine->multicore, max_cycles);
+	}
+
+	return run_engine(&machine->sim, machine->config.engine, max_cycles);
+}
+
+/*
+  description:
+	brings trace, hwregtrace, leds and display7seg up to date on disk, with the async output pipeline drained
+	and restarted around it.
+
+*/
+static void flush_outputs(simulator_t* sim) {
+
+	if (sim->output != NULL) {
+		output_stop(sim->output);
+	}
+
+	if (sim->trace != NULL) writer_flush(sim->trace);
+	if (sim->hwregtrace_log.writer != NULL) writer_flush(sim->hwregtrace_log.writer);
+	if (sim->leds_log.writer != NULL) writer_flush(sim->leds_log.writer);
+	if (sim->display7seg_log.writer != NULL) writer_flush(sim->display7seg_log.writer);
+
+	if (sim->output != NULL) {
+		sim->output = output_start(sim);
+	}
+}
+
+/*
+  description:
+	writes dmemout, regout, cycles, diskout, monitor, monitor.yuv, the profile and its stacks and the counters as
+	they stand, and flushes the streamed outputs.
+	the other cores of a multi-core machine write their own regout and cycles and flush their streamed outputs.
+	can be called at any point between runs, the machine carries on unchanged.
+
+*/
+void simp_dump(simp_machine_t* machine) {
+
+	simulator_t* sim = &machine->sim;
+	simp_config_t* config = &machine->config;
+
+	flush_outputs(sim);
+
+	if (config->dmemout != NULL) {
+		write_memory_image(config->dmemout, DMEM_LINE_SIZE, sim->state.dmem, MEM_SIZE);
+	}
+
+	if (config->regout != NULL) {
+		write_memory_image(config->regout, DMEM_LINE_SIZE, (uint32_t*)sim->state.R + 3, NUM_OF_REGISTERS - 3);   // regout, R3 to R15.
+	}
+
+	if (config->cycles != NULL) {
+
+		char clock_output[24];
+		int clock_length = sprintf_s(clock_output, sizeof(clock_output), "%lld", (long long)sim->clock);
+
+		write_file(config->cycles, clock_output, clock_length, 0);
+	}
+
+	if (config->diskout != NULL) {
+
+		if (config->diskin != NULL && strcmp(config->diskin, config->diskout) == 0) {
+			disk_load_all(sim->disk);        // diskout replaces diskin, which is still mapped.
+		}
+
+		disk_write_image(sim->disk, config->diskout);
+	}
+
+	if (config->monitor != NULL) {
+		write_file(config->monitor, sim->monitor, MONITOR_PIXELS * (MONITOR_LINE_SIZE + 1) - 1, 0);
+	}
+
+	if (config->monitor_yuv != NULL) {
+		write_file(config->monitor_yuv, sim->monitor_hex, MONITOR_PIXELS, 1);
+	}
+
+	if (sim->profile != NULL) {
+		write_profile(sim->profile, sim->imem, config->profile);
+
+		if (config->stacks != NULL) {
+			write_stacks(sim->profile, config->stacks);
+		}
+	}
+
+	if (sim->stats != NULL) {
+		write_stats(sim->stats, sim, config->stats);
+	}
+
+	if (machine->multicore != NULL) {
+		for (int core = 1; core < machine->multicore->num_of_cores; core++) {
+			simp_dump(machine->multicore->cores[core]);     // only names the core's own outputs.
+		}
+	}
+}
+
+/*
+  description:
+	closes the streamed outputs and releases the machine, but not the shared inputs it was loaded with.
+
+*/
+void simp_free(simp_machine_t* machine) {
+
+	simulator_t* sim = &machine->sim;
+	const simp_inputs_t* inputs = machine->config.inputs;
+
+	if (machine->multicore != NULL) {
+		multicore_free(machine->multicore);
+	}
+
+	if (sim->output != NULL) {
+		output_stop(sim->output);     // the writer thread hands trace and event logs back before they are closed.
+	}
+
+	if (sim->trace != NULL) {
+		writer_close(sim->trace);
+	}
+
+	event_log_close(&sim->hwregtrace_log);
+	event_log_close(&sim->leds_log);
+	event_log_close(&sim->display7seg_log);
+
+	if (inputs == NULL || inputs->imem == NULL) {
+		free(sim->imem);
+		free(sim->decoded_imem);
+	}
+
+	if (inputs == NULL || inputs->irq2_up_clocks == NULL) {
+		free(sim->irq2_up_clocks);
+	}
+
+	if (sim->profile != NULL) {
+		profile_free(sim->profile);
+	}
+
+	free(sim->stats);
+	jit_free(sim);
+
+	free(sim->state.dmem);
+	disk_close(&machine->disk);
+	free(sim->monitor);
+	free(sim->monitor_hex);
+	free(machine);
+}
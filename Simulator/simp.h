@@ -0,0 +1,98 @@
+#ifndef __SIMP_H__
+#define __SIMP_H__
+
+#include "simulator.h"
+
+/*
+  description:
+	the simulator as a library, built on its own as the SimulatorLib static library. every machine keeps all of its
+	state in its simp_machine_t, so any number of them can be loaded and run side by side in one process. the
+	Simulator command line is a wrapper that loads one machine from its arguments and runs it to halt.
+
+	simp_machine_t* machine = simp_load(&config);
+	while (simp_run(machine, 1000000) == SIMP_RUNNING) { ... }
+	simp_dump(machine);
+	simp_free(machine);
+
+	errors end the process with a message, as they do on the command line.
+
+*/
+
+#define SIMP_RUNNING 0
+#define SIMP_HALTED 1
+#define SIMP_NO_LIMIT NEVER				// simp_run cycle count that runs until halt.
+
+/*
+  description:
+	input files parsed ahead of time, shared by every machine loaded with them so that many runs of one program
+	don't each read and predecode it. machines only read imem and irq2in, and start from a copy of dmem, so a set
+	can be shared across threads. NULL fields are read from the files the config names. the caller frees them,
+	after every machine loaded with them.
+
+*/
+typedef struct {
+	char* imem;								// imemin text, with decoded_imem predecoded for the config's engine.
+	decoded_instruction_t* decoded_imem;
+	uint32_t* dmem;
+	int* irq2_up_clocks;
+	int num_irq2_up_clocks;
+} simp_inputs_t;
+
+/*
+  description:
+	the files a machine is loaded from and writes, in the order the command line takes them, and its options.
+	a NULL input reads as an empty file. a NULL output isn't written: with no trace the trace isn't built at all,
+	the event logs drop their records and simp_dump skips the file.
+
+*/
+typedef struct {
+	char* imemin;
+	char* dmemin;
+	char* diskin;
+	char* irq2in;
+	char* dmemout;
+	char* regout;
+	char* trace;
+	char* hwregtrace;
+	char* cycles;
+	char* leds;
+	char* display7seg;
+	char* diskout;
+	char* monitor;
+	char* monitor_yuv;
+
+	engine_t engine;
+	int trace_binary;
+	int async_output;
+	int fast_forward;
+	int disk_sectors;
+	char* checkpoint;						// checkpoint file, NULL for none.
+	int64_t checkpoint_every;				// cycles between periodic checkpoints, 0 for requested ones only.
+	char* restore;							// checkpoint to resume from, NULL to start from the input files.
+	int cores;								// SIMP cores sharing dmem, see multicore.h.
+	int64_t quantum;						// cycles between the free running cores' barriers, 0 to run them in lockstep.
+	char* profile;							// hot spot report written by simp_dump, NULL to run unprofiled.
+	char* symbols;							// assembler symbol map naming the report's addresses, NULL for none.
+	char* stacks;							// collapsed call stacks of the profile, NULL for none.
+	char* stats;							// JSON counters written by simp_dump, NULL to count nothing.
+
+	const simp_inputs_t* inputs;			// inputs already parsed, NULL to read them all.
+} simp_config_t;
+
+typedef struct simp_machine {
+	simulator_t sim;						// core 0 on a multi-core machine.
+	simp_config_t config;
+	disk_t disk;
+	struct multicore* multicore;			// the other cores, NULL on a single core machine.
+} simp_machine_t;
+
+void simp_default_config(simp_config_t* config);
+void simp_check_config(simp_config_t* config);
+simp_machine_t* simp_load(const simp_config_t* config);
+int simp_step(simp_machine_t* machine);
+int simp_run(simp_machine_t* machine, int64_t max_cycles);
+void simp_dump(simp_machine_t* machine);
+void simp_free(simp_machine_t* machine);
+int run_engine(simulator_t* sim, engine_t engine, int64_t max_cycles);
+
+#endif
@@ -0,0 +1,1206 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+
+#include "simulator.h"
+#include "trace_binary.h"
+#include "output.h"
+#include "idle.h"
+#include "checkpoint.h"
+#include "multicore.h"
+#include "stats.h"
+#include "log.h"
+#include "../Common/hex.h"
+
+log_level_t log_level = LOG_LEVEL_INFO;
+
+/*
+  description: 
+	malloc wrapper with added check
+ 
+*/
+void* calloc_and_check(size_t count, size_t elem_size) {
+
+	void* ptr = calloc(count, elem_size);
+
+	if (ptr == NULL) {
+		printf("Memory assignment error encountered\nTerminating program...");
+		exit(-1);
+	}
+
+	return (ptr);
+}
+
+/*
+  description:
+	 return 1 if illegal write is attempted to $0/$imm1/$imm2 or to a negative index, return 0 otherwise.
+
+*/
+int check_illegal_write(int index) {
+	
+	if (index < 3) {
+		LOG_WARNING("illegal write attempt detected.\nskipping instruction...\n");
+		return 1;
+	}
+	return 0;
+}
+
+/*
+  description:
+	Converts 'hex_size' digits of hex to decimal.
+
+	params:
+		in hex_data - buffer containing the hex representation.
+		in hex_size - number of digits to convert.
+		in,out hex_index - used to increment index when converting a stream of hex numbers. input NULL when no need for increment. 
+		in sign_flag - when flag is 1, return signed value of hex.
+*/
+int hex_to_dec(char *hex_data, int hex_size, int *hex_index, int signed_flag) {
+
+	uint32_t value = hex_parse(hex_data, hex_size);
+	int bits = hex_size * 4;
+	int decimal = (int32_t)value;
+
+	if (signed_flag && bits < WORD && ((value >> (bits - 1)) & 1)) {     // signed hex, sign extend from the top digit.
+
+		decimal = (int32_t)(value | (0xFFFFFFFFu << bits));
+	}
+
+	if (hex_index != NULL) {
+		*hex_index += hex_size;
+	}
+
+	return decimal;
+}
+
+/*
+  description:
+	decimal to digit hex, stored in indicated array.
+
+	params:
+		in hex - array that stores the hex representation. 
+		in dec - decimal number to convert.
+		in size - number of digits in hex representation - Padded with zeros
+*/
+void dec_to_hex(char* hex, int dec, int size, int lowercase_flag) {
+
+	hex_format(hex, (uint32_t)dec, size, !lowercase_flag);		// negative numbers come out in two's complement.
+}
+
+/*
+  description:
+	 format a binary memory image as 8 digit hex lines into one buffer and write it to file in one go.
+
+*/
+void write_memory_image(char* p_fname, int line_size, uint32_t* image, int words) {
+
+	size_t stride = (size_t)line_size + 1;
+	char* text = calloc_and_check(words * stride, sizeof(char));
+
+	memset(text, '\n', words * stride);
+	hex_encode_words(text, image, words, stride, 1);
+
+	write_file(p_fname, text, words * stride - 1, 0);		// no newline after the last line.
+	free(text);
+}
+
+/*
+  description:
+	appends the trace line for the current clock to the trace writer, returns the line.
+	lines are separated by newlines, with no newline after the last one.
+
+*/
+char* build_trace(writer_t* trace, uint32_t PC, const char* instruction, const int32_t R[NUM_OF_REGISTERS], int64_t clock) {
+
+	char* line;
+
+	if (clock != 0) {
+		memset(writer_reserve(trace, 1), '\n', 1);
+	}
+
+	line = writer_reserve(trace, TRACE_LINE_SIZE);
+
+	hex_format(line, PC, 3, 1);			 // 3 digit PC, the instruction text, then the registers as 8 digit hex.
+	line[3] = ' ';
+	memcpy(line + 4, instruction, IMEM_LINE_SIZE);
+	memset(line + 4 + IMEM_LINE_SIZE, ' ', TRACE_LINE_SIZE - 4 - IMEM_LINE_SIZE);
+
+	hex_encode_words(line + 5 + IMEM_LINE_SIZE, (const uint32_t*)R, NUM_OF_REGISTERS, DMEM_LINE_SIZE + 1, 0);
+
+	return line;
+}
+
+/*
+  description:
+	records the current clock in the trace, text or binary. returns the text line, NULL for the binary trace and for
+	async output.
+
+*/
+char* write_trace(simulator_t* sim, uint32_t PC, int64_t clock) {
+
+	return write_trace_row(sim, PC, sim->state.R, clock);
+}
+
+/*
+  description:
+	as write_trace, for a row whose registers aren't the current ones. used for cycles skipped by --fast-forward.
+
+*/
+char* write_trace_row(simulator_t* sim, uint32_t PC, const int32_t R[NUM_OF_REGISTERS], int64_t clock) {
+
+	if (sim->output != NULL) {
+		output_trace(sim->output, PC, clock, R);
+		return NULL;
+	}
+
+	if (sim->trace_binary) {
+		build_binary_trace(sim->trace, PC, R, sim->trace_previous);
+		return NULL;
+	}
+
+	return build_trace(sim->trace, PC, sim->imem + PC * IMEM_LINE_SIZE, R, clock);
+}
+
+/*
+  description:
+	number of instructions in the program, i.e. up to the last imem line that isn't all zeros.
+
+*/
+int program_length(const char* imem) {
+
+	int length;
+
+	for (length = MEM_SIZE; length > 0; length--) {
+
+		if (memcmp(imem + (length - 1) * IMEM_LINE_SIZE, "000000000000", IMEM_LINE_SIZE) != 0) {
+			break;
+		}
+	}
+
+	return length;
+}
+
+const char io_register_names[NUM_OF_IO_REGISTERS][IO_REGISTER_NAME_SIZE] = { "irq0enable", "irq1enable", "irq2enable", "irq0status", "irq1status", "irq2status", "irqhandler", "irqreturn",
+			  "clks", "leds", "display7seg", "timerenable", "timercurrent", "timermax", "diskcmd", "disksector", "diskbuffer", "diskstatus",
+			  "res1", "res2", "monitoraddr", "monitordata", "monitorcmd",
+			  "instructions", "branchestaken", "branchesnottaken", "loads", "stores", "ioreads", "iowrites", "interrupts", "irqcycles", "diskcommands" };
+
+/*
+  description:
+	logs this cycle's IO register access to hwregtrace, if there was one.
+
+*/
+void write_hwregtrace(event_log_t* log, int *hw_info, int64_t clock) {
+
+	char record[64];
+	char DATA[9];
+	int length;
+
+	if (hw_info[1] == 0) {   // no read/write this clock cycle.
+
+		return;
+
+	}
+
+	DATA[8] = '\0';
+	dec_to_hex(DATA, hw_info[2], 8, 1);
+
+	length = sprintf_s(record, sizeof(record), "%lld %s %s %s", (long long)clock, hw_info[1] == 1 ? "READ" : "WRITE", io_register_names[hw_info[0]], DATA);
+	event_log_write(log, record, length);
+
+	memset(hw_info, 0, 3 * sizeof(int));
+}
+
+/*
+  description:
+	logs an io register access to hwregtrace, through the async output pipeline when it is running.
+
+*/
+void log_hwregtrace(simulator_t* sim, int* hw_info, int64_t clock) {
+
+	if (sim->output != NULL) {
+
+		output_event(sim->output, OUTPUT_HWREGTRACE, clock, hw_info[2], hw_info[0], hw_info[1]);
+		memset(hw_info, 0, 3 * sizeof(int));
+	}
+	else {
+		write_hwregtrace(&sim->hwregtrace_log, hw_info, clock);
+	}
+}
+
+/*
+  description:
+
+	writes both leds and display7seg as their format is the same. 
+
+*/
+void write_output(event_log_t* log, int64_t clock, int led_data) {
+
+	char record[32];
+	char DATA[9];
+	int length;
+
+	DATA[8] = '\0';
+	dec_to_hex(DATA, led_data, 8, 1);
+
+	length = sprintf_s(record, sizeof(record), "%lld %s", (long long)clock, DATA);
+	event_log_write(log, record, length);
+}
+
+#define write_leds write_output
+#define write_display7seg write_output
+
+/*
+  description:
+	decodes the given instruction from hex to dec, storing the results in the given instruction struct.
+
+*/
+void decode_instruction(char* hex_data, decoded_instruction_t* inst) {
+
+	int hex_index = 0;
+
+	inst->opcode = hex_to_dec(hex_data + hex_index, 2, &hex_index, 0);
+	inst->rd = hex_to_dec(hex_data + hex_index, REG_INSTRUCTION_SIZE, &hex_index, 0);
+	inst->rs = hex_to_dec(hex_data + hex_index, REG_INSTRUCTION_SIZE, &hex_index, 0);  // hex_index incremented inside func
+	inst->rt = hex_to_dec(hex_data + hex_index, REG_INSTRUCTION_SIZE, &hex_index, 0);
+	inst->rm = hex_to_dec(hex_data + hex_index, REG_INSTRUCTION_SIZE, &hex_index, 0);
+	inst->imm1 = hex_to_dec(hex_data + hex_index, IMM_INSTRUCTION_SIZE, &hex_index, 1);
+	inst->imm2 = hex_to_dec(hex_data + hex_index, IMM_INSTRUCTION_SIZE, &hex_index, 1);
+	inst->handler = NULL;
+}
+
+/*
+  description:
+	instruction semantics, one function per opcode. shared by the switch interpreter and the threaded engine.
+	arithmetic is done on uint32_t so overflow wraps around instead of being undefined, shift amounts are taken modulo 32.
+
+*/
+static inline void exec_add(const decoded_instruction_t* inst, machine_state_t* state) {
+
+	int32_t* R = state->R;
+	int32_t result = (int32_t)((uint32_t)R[inst->rs] + (uint32_t)R[inst->rt] + (uint32_t)R[inst->rm]);
+
+	if (check_illegal_write(inst->rd)) return;
+	R[inst->rd] = result;
+}
+
+static inline void exec_sub(const decoded_instruction_t* inst, machine_state_t* state) {
+
+	int32_t* R = state->R;
+	int32_t result = (int32_t)((uint32_t)R[inst->rs] - (uint32_t)R[inst->rt] - (uint32_t)R[inst->rm]);
+
+	if (check_illegal_write(inst->rd)) return;
+	R[inst->rd] = result;
+}
+
+static inline void exec_mac(const decoded_instruction_t* inst, machine_state_t* state) {
+
+	int32_t* R = state->R;
+	int32_t result = (int32_t)((uint32_t)R[inst->rs] * (uint32_t)R[inst->rt] - (uint32_t)R[inst->rm]);
+
+	if (check_illegal_write(inst->rd)) return;
+	R[inst->rd] = result;
+}
+
+static inline void exec_and(const decoded_instruction_t* inst, machine_state_t* state) {
+
+	int32_t* R = state->R;
+	int32_t result = R[inst->rs] & R[inst->rt] & R[inst->rm];
+
+	if (check_illegal_write(inst->rd)) return;
+	R[inst->rd] = result;
+}
+
+static inline void exec_or(const decoded_instruction_t* inst, machine_state_t* state) {
+
+	int32_t* R = state->R;
+	int32_t result = R[inst->rs] | R[inst->rt] | R[inst->rm];
+
+	if (check_illegal_write(inst->rd)) return;
+	R[inst->rd] = result;
+}
+
+static inline void exec_xor(const decoded_instruction_t* inst, machine_state_t* state) {
+
+	int32_t* R = state->R;
+	int32_t result = R[inst->rs] ^ R[inst->rt] ^ R[inst->rm];
+
+	if (check_illegal_write(inst->rd)) return;
+	R[inst->rd] = result;
+}
+
+static inline void exec_sll(const decoded_instruction_t* inst, machine_state_t* state) {
+
+	int32_t* R = state->R;
+	int32_t result = (int32_t)((uint32_t)R[inst->rs] << (R[inst->rt] & (WORD - 1)));     // sll - shifting is cyclical, 32 is a zero shift.
+
+	if (check_illegal_write(inst->rd)) return;
+	R[inst->rd] = result;
+}
+
+static inline void exec_sra(const decoded_instruction_t* inst, machine_state_t* state) {
+
+	int32_t* R = state->R;
+	int32_t result = R[inst->rs] >> (R[inst->rt] & (WORD - 1));
+
+	if (check_illegal_write(inst->rd)) return;
+	R[inst->rd] = result;
+}
+
+static inline void exec_srl(const decoded_instruction_t* inst, machine_state_t* state) {
+
+	int32_t* R = state->R;
+	int32_t result = (int32_t)((uint32_t)R[inst->rs] >> (R[inst->rt] & (WORD - 1)));
+
+	if (check_illegal_write(inst->rd)) return;
+	R[inst->rd] = result;
+}
+
+static inline void branch_to(machine_state_t* state, int32_t target) {
+
+	state->PC = target & PC_MASK;
+	state->PC_set_flag = 1;
+}
+
+static inline void exec_beq(const decoded_instruction_t* inst, machine_state_t* state) {
+
+	if (state->R[inst->rs] == state->R[inst->rt]) branch_to(state, state->R[inst->rm]);
+}
+
+static inline void exec_bne(const decoded_instruction_t* inst, machine_state_t* state) {
+
+	if (state->R[inst->rs] != state->R[inst->rt]) branch_to(state, state->R[inst->rm]);
+}
+
+static inline void exec_blt(const decoded_instruction_t* inst, machine_state_t* state) {
+
+	if (state->R[inst->rs] < state->R[inst->rt]) branch_to(state, state->R[inst->rm]);
+}
+
+static inline void exec_bgt(const decoded_instruction_t* inst, machine_state_t* state) {
+
+	if (state->R[inst->rs] > state->R[inst->rt]) branch_to(state, state->R[inst->rm]);
+}
+
+static inline void exec_ble(const decoded_instruction_t* inst, machine_state_t* state) {
+
+	if (state->R[inst->rs] <= state->R[inst->rt]) branch_to(state, state->R[inst->rm]);
+}
+
+static inline void exec_bge(const decoded_instruction_t* inst, machine_state_t* state) {
+
+	if (state->R[inst->rs] >= state->R[inst->rt]) branch_to(state, state->R[inst->rm]);
+}
+
+static inline void exec_jal(const decoded_instruction_t* inst, machine_state_t* state) {
+
+	int32_t result = state->PC + 1;
+
+	if (check_illegal_write(inst->rd)) return;
+	state->R[inst->rd] = result;
+
+	branch_to(state, state->R[inst->rm]);
+}
+
+static inline void exec_lw(const decoded_instruction_t* inst, machine_state_t* state) {
+
+	int32_t* R = state->R;
+	int32_t index = R[inst->rs] + R[inst->rt];
+
+	if (index < 0 || index >= MEM_SIZE) {
+		LOG_WARNING("\n Assembly instructions bug: attempting access to out of range index; skipping instruction!\n");
+		return;
+	}
+
+	int32_t result = (int32_t)(state->dmem[index] + (uint32_t)R[inst->rm]);
+
+	if (check_illegal_write(inst->rd)) return;
+	R[inst->rd] = result;
+}
+
+static inline void exec_sw(const decoded_instruction_t* inst, machine_state_t* state) {
+
+	int32_t* R = state->R;
+	int32_t index = R[inst->rs] + R[inst->rt];
+
+	if (index < 0 || index >= MEM_SIZE) {
+		LOG_WARNING("\n *Assembly instructions bug: attempting write to out of range index; skipping instruction!*\n\n");
+		return;
+	}
+
+	state->dmem[index] = (uint32_t)R[inst->rm] + (uint32_t)R[inst->rd];
+}
+
+static inline void exec_reti(const decoded_instruction_t* inst, machine_state_t* state) {
+
+	branch_to(state, state->IO[IRQRETURN]);
+	state->irq_subroutine_flag = 0;
+}
+
+static inline void exec_in(const decoded_instruction_t* inst, machine_state_t* state) {
+
+	int32_t* R = state->R;
+	int32_t index = R[inst->rs] + R[inst->rt];
+
+	if (index < 0 || index >= NUM_OF_IO_REGISTERS) {
+		LOG_WARNING("\n Assembly instructions bug: attempting access to out of range index; skipping instruction!\n");
+		return;
+	}
+
+	int32_t result = state->IO[index];
+
+	if (check_illegal_write(inst->rd)) return;
+	R[inst->rd] = result;
+
+	state->hw_info[0] = index;  // which register was changed.
+	state->hw_info[1] = 1;      // 1 indicating hw READ operation.
+	state->hw_info[2] = result;
+}
+
+static inline void exec_out(const decoded_instruction_t* inst, machine_state_t* state) {
+
+	int32_t* R = state->R;
+	int32_t index = R[inst->rs] + R[inst->rt];
+
+	if (index < 0 || index >= NUM_OF_IO_REGISTERS) {
+		LOG_WARNING("\n Assembly instructions bug: attempting write to out of range index; skipping instruction!\n");
+		return;
+	}
+
+	int32_t result = R[inst->rm];
+	state->IO[index] = result;
+
+	state->hw_info[0] = index;  // which register was changed.
+	state->hw_info[1] = 2;      // 2 indicating hw WRITE operation.
+	state->hw_info[2] = result;
+}
+
+static inline void exec_halt(const decoded_instruction_t* inst, machine_state_t* state) {
+
+	LOG_INFO("HALT;\n");
+	state->halt_flag = 1;
+}
+
+static inline void exec_invalid(const decoded_instruction_t* inst, machine_state_t* state) {
+
+	LOG_WARNING("OPCODE out of range\nSkipping instruction.\n");
+}
+
+/*
+  description:
+
+	executes a single assembly instruction.
+
+*/
+void execute_instruction(const decoded_instruction_t *inst, machine_state_t *state) {
+
+	switch (inst->opcode) {
+
+	case 0:  exec_add(inst, state);  break;
+	case 1:  exec_sub(inst, state);  break;
+	case 2:  exec_mac(inst, state);  break;
+	case 3:  exec_and(inst, state);  break;
+	case 4:  exec_or(inst, state);   break;
+	case 5:  exec_xor(inst, state);  break;
+	case 6:  exec_sll(inst, state);  break;
+	case 7:  exec_sra(inst, state);  break;
+	case 8:  exec_srl(inst, state);  break;
+	case 9:  exec_beq(inst, state);  break;
+	case 10: exec_bne(inst, state);  break;
+	case 11: exec_blt(inst, state);  break;
+	case 12: exec_bgt(inst, state);  break;
+	case 13: exec_ble(inst, state);  break;
+	case 14: exec_bge(inst, state);  break;
+	case 15: exec_jal(inst, state);  break;
+	case 16: exec_lw(inst, state);   break;
+	case 17: exec_sw(inst, state);   break;
+	case 18: exec_reti(inst, state); break;
+	case 19: exec_in(inst, state);   break;
+	case 20: exec_out(inst, state);  break;
+	case 21: exec_halt(inst, state); break;
+
+	default:
+		exec_invalid(inst, state);
+	}
+
+}
+
+/*
+  description:
+	schedules the timer expiry from the timer registers as they stand at the start of 'clock'.
+	called at start up, after an expiry and after a write to a timer register or irq0status.
+
+*/
+void schedule_timer(simulator_t* sim, int64_t clock) {
+
+	const int32_t* IO_registers = sim->state.IO;
+	int64_t expiry = NEVER;
+
+	if (IO_registers[TIMERCURRENT] == IO_registers[TIMERMAX]) {
+
+		if (IO_registers[IRQ0STATUS] != 1 || IO_registers[TIMERCURRENT] != 0) {
+			expiry = clock;
+		}
+		else if (IO_registers[TIMERENABLE]) {
+			expiry = clock + ((int64_t)1 << 32);			// expiry changes nothing now, timercurrent has to wrap around.
+		}
+	}
+	else if (IO_registers[TIMERENABLE]) {
+
+		expiry = clock + (uint32_t)(IO_registers[TIMERMAX] - IO_registers[TIMERCURRENT]);
+	}
+
+	schedule_event(&sim->events, EVENT_TIMER, expiry);
+}
+
+/*
+  description:
+	schedules the next irq2 edge. an edge listed for clock n is seen at the start of clock n + 1,
+	edges that are already behind 'clock' never fire.
+
+*/
+void schedule_irq2(simulator_t* sim, int64_t clock) {
+
+	int64_t edge = NEVER;
+
+	if (sim->irq2_up_clocks_index < sim->num_irq2_up_clocks) {
+
+		edge = (int64_t)sim->irq2_up_clocks[sim->irq2_up_clocks_index] + 1;
+		if (edge < clock) edge = NEVER;
+	}
+
+	schedule_event(&sim->events, EVENT_IRQ2, edge);
+}
+
+/*
+  description:
+	schedules the running disk command's completion. the command completes at the end of the cycle where clks equals
+	disk_read_end, which is seen at the start of the next one. called from end_cycle, before clks is incremented.
+
+*/
+void schedule_disk(simulator_t* sim) {
+
+	const int32_t* IO_registers = sim->state.IO;
+
+	if (IO_registers[DISKCMD] == 0 || sim->disk_read_end == 0) {
+		cancel_event(&sim->events, EVENT_DISK);
+		return;
+	}
+
+	schedule_event(&sim->events, EVENT_DISK, sim->clock + (uint32_t)(sim->disk_read_end - IO_registers[CLKS]) + 1);
+}
+
+/*
+  description:
+	transfers a sector between disk and dmem in one go and marks the disk busy for 1024 cycles.
+
+*/
+void start_disk(simulator_t* sim) {
+
+	machine_state_t* state = &sim->state;
+	int32_t* IO_registers = state->IO;
+
+	int disksector = (int)((uint32_t)IO_registers[DISKSECTOR] % (uint32_t)sim->disk->num_of_sectors);
+	int diskbuffer = IO_registers[DISKBUFFER] & (MEM_SIZE - 1);
+
+	if (diskbuffer > MEM_SIZE - SECTOR_SIZE) {
+		diskbuffer = MEM_SIZE - SECTOR_SIZE;       // keep the sector transfer inside dmem.
+	}
+
+	if (sim->multicore != NULL) {
+		lock_devices(sim->multicore);
+	}
+
+	if (IO_registers[DISKCMD] == 1) {      // read from disk
+
+		disk_read(sim->disk, disksector, state->dmem + diskbuffer);
+
+	}
+	else {                   // write to disk
+
+		disk_write(sim->disk, disksector, state->dmem + diskbuffer);
+	}
+
+	if (sim->multicore != NULL) {
+		unlock_devices(sim->multicore);
+	}
+
+	if (sim->stats != NULL) {
+		count_disk_command(sim->stats, state, IO_registers[DISKCMD] == 1);
+	}
+
+	IO_registers[DISKSTATUS] = 1;
+	sim->disk_read_end = IO_registers[CLKS] + 1024;
+}
+
+/*
+  description:
+	side effects of an out instruction, applied in end_cycle of the same cycle. peripherals are only
+	looked at when one of their registers is written, everything else waits in the event scheduler.
+
+*/
+void io_register_written(simulator_t* sim, int index) {
+
+	int32_t* IO_registers = sim->state.IO;
+
+	if (index >= INSTRUCTIONS) {      // read only counters.
+		IO_registers[index] = sim->stats != NULL ? (int32_t)sim->stats->counters[index - INSTRUCTIONS] : 0;
+		return;
+	}
+
+	switch (index) {
+
+	case LEDS:
+
+		if (sim->leds != IO_registers[LEDS]) {				// if leds register has been changed, write it to leds.txt
+
+			sim->leds = IO_registers[LEDS];
+
+			if (sim->output != NULL)
+				output_event(sim->output, OUTPUT_LEDS, sim->clock, sim->leds, 0, 0);
+			else
+				write_leds(&sim->leds_log, sim->clock, sim->leds);
+		}
+		break;
+
+	case DISPLAY7SEG:
+
+		if (sim->display7seg != IO_registers[DISPLAY7SEG]) {      // if display7seg register has been changed, write it to display7seg.txt
+
+			sim->display7seg = IO_registers[DISPLAY7SEG];
+
+			if (sim->output != NULL)
+				output_event(sim->output, OUTPUT_DISPLAY7SEG, sim->clock, sim->display7seg, 0, 0);
+			else
+				write_display7seg(&sim->display7seg_log, sim->clock, sim->display7seg);
+		}
+		break;
+
+	case DISKCMD:
+	case CLKS:
+
+		if (IO_registers[DISKCMD] != 0 && sim->disk_read_end == 0) {
+			start_disk(sim);
+		}
+
+		schedule_disk(sim);
+		break;
+
+	case MONITORCMD:
+
+		if (IO_registers[MONITORCMD] == 1) {
+
+			int monitoraddr = IO_registers[MONITORADDR] & (MONITOR_PIXELS - 1);
+
+			if (sim->multicore != NULL) {
+				lock_devices(sim->multicore);
+			}
+
+			dec_to_hex(sim->monitor + monitoraddr * (MONITOR_LINE_SIZE + 1), IO_registers[MONITORDATA], 2, 0);  // monitor.txt data
+			sim->monitor_hex[monitoraddr] = (char)IO_registers[MONITORDATA];				  // monitor.yuv data
+
+			if (sim->multicore != NULL) {
+				unlock_devices(sim->multicore);
+			}
+
+			IO_registers[MONITORCMD] = 0;
+		}
+		break;
+
+	case COREID:
+
+		IO_registers[COREID] = sim->core_id;			// read only.
+		break;
+
+	case TIMERENABLE:
+	case TIMERCURRENT:
+	case TIMERMAX:
+	case IRQ0STATUS:
+
+		sim->timer_dirty = 1;			// rescheduled once timercurrent was incremented.
+		break;
+	}
+}
+
+/*
+  description:
+	applies every peripheral event due at the start of the current clock.
+
+*/
+void service_events(simulator_t* sim) {
+
+	int32_t* IO_registers = sim->state.IO;
+	int kind;
+
+	while ((kind = pop_due_event(&sim->events, sim->clock)) >= 0) {
+
+		switch (kind) {
+
+		case EVENT_CHECKPOINT:
+
+			checkpoint_event(sim);
+			break;
+
+		case EVENT_TIMER:
+
+			IO_registers[IRQ0STATUS] = 1;
+			IO_registers[TIMERCURRENT] = 0;
+			sim->timer_dirty = 1;
+			break;
+
+		case EVENT_IRQ2:
+
+			IO_registers[IRQ2STATUS] = 1;
+			sim->irq2_up_clocks_index++;
+			schedule_irq2(sim, sim->clock + 1);
+			break;
+
+		case EVENT_DISK:
+
+			IO_registers[DISKCMD] = 0;
+			IO_registers[DISKSTATUS] = 0;
+			IO_registers[IRQ1STATUS] = 1;
+			sim->disk_read_end = 0;
+			break;
+
+		case EVENT_RUN_LIMIT:
+
+			break;
+		}
+	}
+}
+
+/*
+  description:
+	schedules the peripheral events of a machine that is about to run its first cycle.
+
+*/
+void init_events(simulator_t* sim) {
+
+	scheduler_init(&sim->events);
+	sim->timer_dirty = 0;
+	sim->run_limit = NEVER;
+
+	schedule_timer(sim, sim->clock);
+	schedule_irq2(sim, sim->clock);
+	schedule_disk(sim);
+	schedule_checkpoint(sim);
+}
+
+/*
+  description:
+	start of a clock cycle: due peripheral events and interrupt entry, then fetch and trace.
+	returns the instruction to execute this cycle.
+
+*/
+const decoded_instruction_t* begin_cycle(simulator_t* sim) {
+
+	machine_state_t* state = &sim->state;
+	int32_t* IO_registers = state->IO;
+	int irq;
+
+	if (sim->clock >= next_event_clock(&sim->events)) {
+		service_events(sim);
+	}
+
+	irq = (IO_registers[IRQ0ENABLE] & IO_registers[IRQ0STATUS]) | (IO_registers[IRQ1ENABLE] & IO_registers[IRQ1STATUS]) | (IO_registers[IRQ2ENABLE] & IO_registers[IRQ2STATUS]);
+
+	if (irq) {
+
+		if (state->irq_subroutine_flag == 0) {
+
+			IO_registers[IRQRETURN] = state->PC;	  // save current PC in irqreturn
+			LOG_DEBUG("irqreturn = %d\n", IO_registers[IRQRETURN]);
+			state->PC = IO_registers[IRQHANDLER] & PC_MASK; // set PC to irqhandler address
+			state->irq_subroutine_flag = 1;
+
+		}
+
+	}
+
+	const decoded_instruction_t* inst = &sim->decoded_imem[state->PC];
+
+	state->R[1] = inst->imm1;		//  store imm1 and imm2 in their respective registers.
+	state->R[2] = inst->imm2;
+
+	LOG_DEBUG(" \nPC : %d || clock %lld\n", state->PC, (long long)sim->clock);
+
+	if (sim->trace_enabled) {
+
+		char* trace_line = write_trace(sim, state->PC, sim->clock);
+		if (trace_line != NULL) LOG_DEBUG("TRACE : %.*s\n", TRACE_LINE_SIZE, trace_line);
+	}
+
+	return inst;
+}
+
+/*
+  description:
+	end of a clock cycle: hwregtrace output and the side effects of an io register write, timer, PC and clks.
+	returns 1 once the machine halted or the run reached its limit, see simp_run.
+
+*/
+int end_cycle(simulator_t* sim) {
+
+	machine_state_t* state = &sim->state;
+	int32_t* IO_registers = state->IO;
+	int loop_visit = state->PC_set_flag;		// a branch or an io read, where idle loops are looked for.
+
+	if (LOG_DEBUG_ENABLED) {
+
+		LOG_DEBUG("$a0 = %d, $a1 = %d\n\n", state->R[4], state->R[5]);
+
+		int mem_ind = 2000;
+		char temp_hex[9];
+		temp_hex[8] = '\0';
+
+		for (mem_ind = 2000; mem_ind > 1980; mem_ind--) {
+			dec_to_hex(temp_hex, state->dmem[mem_ind], 8, 1);
+			LOG_DEBUG("%s ||", temp_hex);
+		}
+	}
+
+
+	if (state->hw_info[1] != 0) {
+
+		int index = state->hw_info[0];
+		int access = state->hw_info[1];
+
+		log_hwregtrace(sim, state->hw_info, sim->clock);
+
+		if (sim->stats != NULL) {
+			count_io_access(sim->stats, state, index, access);
+		}
+
+		if (access == 2) {
+			io_register_written(sim, index);
+		}
+		else {
+			loop_visit = 1;
+		}
+	}
+
+	if (IO_registers[TIMERENABLE]) {
+
+		IO_registers[TIMERCURRENT]++;
+
+	}
+
+	if (sim->timer_dirty) {
+
+		schedule_timer(sim, sim->clock + 1);
+		sim->timer_dirty = 0;
+	}
+
+	if (state->PC_set_flag == 0) {
+
+		state->PC = (state->PC + 1) & PC_MASK;  // increment if PC wasnt already set by a branch.
+
+	}
+
+	if (state->halt_flag) {
+
+		return 1;
+
+	}
+
+
+	IO_registers[CLKS]++;
+	IO_registers[IRQ2STATUS] = 0;
+	state->PC_set_flag = 0;
+
+	sim->clock++;   // software clock
+
+	if (sim->clock >= sim->run_limit) {
+		return 1;
+	}
+
+	if (sim->fast_forward && loop_visit) {
+		skip_idle_loop(sim);
+	}
+
+	return 0;
+}
+
+/*
+  description:
+	number of upcoming cycles in which neither begin_cycle nor end_cycle can observe a peripheral event, assuming
+	no in/out/reti/halt executes: no interrupt entry and no scheduled timer expiry, irq2 edge or disk completion.
+	engines that run such cycles outside begin_cycle/end_cycle report them back through account_quiet_cycles.
+
+*/
+int64_t quiet_cycles(const simulator_t* sim) {
+
+	const int32_t* IO_registers = sim->state.IO;
+	int64_t distance = next_event_clock(&sim->events) - sim->clock;
+
+	int irq = (IO_registers[IRQ0ENABLE] & IO_registers[IRQ0STATUS]) | (IO_registers[IRQ1ENABLE] & IO_registers[IRQ1STATUS]) | (IO_registers[IRQ2ENABLE] & IO_registers[IRQ2STATUS]);
+
+	if (irq && sim->state.irq_subroutine_flag == 0) {
+		return 0;                                                   // interrupt entry on the next cycle.
+	}
+
+	if (distance <= 0) {
+		return 0;
+	}
+
+	return distance < NO_EVENT_CYCLES ? distance : NO_EVENT_CYCLES;
+}
+
+/*
+  description:
+	advances clocks and timer for 'cycles' quiet cycles that were executed outside begin_cycle/end_cycle.
+
+*/
+void account_quiet_cycles(simulator_t* sim, int64_t cycles) {
+
+	int32_t* IO_registers = sim->state.IO;
+
+	if (IO_registers[TIMERENABLE]) {
+
+		IO_registers[TIMERCURRENT] = (int32_t)((uint32_t)IO_registers[TIMERCURRENT] + (uint32_t)cycles);
+
+	}
+
+	IO_registers[CLKS] = (int32_t)((uint32_t)IO_registers[CLKS] + (uint32_t)cycles);
+	sim->clock += cycles;
+}
+
+/*
+  description:
+	reference interpreter, dispatching every instruction through the opcode switch.
+
+*/
+void run_switch(simulator_t* sim) {
+
+	const decoded_instruction_t* inst;
+
+	do {
+
+		inst = begin_cycle(sim);
+		execute_instruction(inst, &sim->state);
+
+	} while (!end_cycle(sim));
+}
+
+#ifndef SIMP_COMPUTED_GOTO
+static const threaded_handler_t threaded_handlers[NUM_OF_OPCODES + 1] = {
+	exec_add, exec_sub, exec_mac, exec_and, exec_or, exec_xor, exec_sll, exec_sra, exec_srl,
+	exec_beq, exec_bne, exec_blt, exec_bgt, exec_ble, exec_bge, exec_jal,
+	exec_lw, exec_sw, exec_reti, exec_in, exec_out, exec_halt,
+	exec_invalid
+};
+#endif
+
+/*
+  description:
+	direct-threaded engine. every decoded instruction carries the address of its handler, so dispatch is a single
+	indirect jump per instruction (computed goto on GCC/Clang, a function pointer call elsewhere).
+
+	quiet cycles, see quiet_cycles, skip begin_cycle and end_cycle: while no peripheral event is due and the trace and
+	the debug dump are off, add through sw run with PC and the remaining budget in locals, and the clocks are advanced
+	once for the whole run. in, out, reti, halt and invalid opcodes, and every cycle outside a quiet run, go through
+	begin_cycle and end_cycle as in the switch interpreter.
+
+	called with sim == NULL it only returns the handler table, indexed by opcode, for predecode_imem to bind.
+
+*/
+const threaded_handler_t* run_threaded(simulator_t* sim) {
+
+#ifdef SIMP_COMPUTED_GOTO
+
+	static const threaded_handler_t threaded_handlers[NUM_OF_OPCODES + 1] = {
+		&&op_add, &&op_sub, &&op_mac, &&op_and, &&op_or, &&op_xor, &&op_sll, &&op_sra, &&op_srl,
+		&&op_beq, &&op_bne, &&op_blt, &&op_bgt, &&op_ble, &&op_bge, &&op_jal,
+		&&op_lw, &&op_sw, &&op_reti, &&op_in, &&op_out, &&op_halt,
+		&&op_invalid
+	};
+
+	if (sim == NULL) {
+		return threaded_handlers;
+	}
+
+	machine_state_t* const state = &sim->state;
+	int32_t* const R = state->R;
+	const decoded_instruction_t* const imem = sim->decoded_imem;
+	const int quiet_enabled = !sim->trace_enabled && !LOG_DEBUG_ENABLED;
+	const decoded_instruction_t* inst;
+	uint32_t PC;
+	int64_t budget = 0;						// quiet cycles left, 0 while cycles go through begin_cycle/end_cycle.
+	int64_t start = 0;
+	int taken;
+
+	// the instruction at PC is done and execution continues at target. a quiet cycle fetches the next instruction
+	// itself, any other cycle ends in end_cycle.
+	#define NEXT(target, branched)  do {																	\
+		if (budget != 0) {																				\
+			PC = (uint32_t)(target) & PC_MASK;															\
+			if (--budget == 0) goto quiet_end;															\
+			inst = &imem[PC];																			\
+			R[1] = inst->imm1;																			\
+			R[2] = inst->imm2;																			\
+			goto *inst->handler;																		\
+		}																								\
+		if (branched) branch_to(state, (target));														\
+		goto cycle_end;																					\
+	} while (0)
+
+	// an instruction that needs the full cycle: a quiet run stops before it, and its cycle begins again normally.
+	#define LEAVE_QUIET()  do {																			\
+		if (budget != 0) {																				\
+			account_quiet_cycles(sim, start - budget);													\
+			state->PC = PC;																				\
+			budget = 0;																					\
+			inst = begin_cycle(sim);																	\
+		}																								\
+	} while (0)
+
+	#define BRANCH(condition)  do { taken = (condition); NEXT(taken ? R[inst->rm] : (int32_t)PC + 1, taken); } while (0)
+
+	inst = begin_cycle(sim);
+	PC = state->PC;
+	goto *inst->handler;
+
+	op_add:  exec_add(inst, state);  NEXT(PC + 1, 0);
+	op_sub:  exec_sub(inst, state);  NEXT(PC + 1, 0);
+	op_mac:  exec_mac(inst, state);  NEXT(PC + 1, 0);
+	op_and:  exec_and(inst, state);  NEXT(PC + 1, 0);
+	op_or:   exec_or(inst, state);   NEXT(PC + 1, 0);
+	op_xor:  exec_xor(inst, state);  NEXT(PC + 1, 0);
+	op_sll:  exec_sll(inst, state);  NEXT(PC + 1, 0);
+	op_sra:  exec_sra(inst, state);  NEXT(PC + 1, 0);
+	op_srl:  exec_srl(inst, state);  NEXT(PC + 1, 0);
+	op_beq:  BRANCH(R[inst->rs] == R[inst->rt]);
+	op_bne:  BRANCH(R[inst->rs] != R[inst->rt]);
+	op_blt:  BRANCH(R[inst->rs] < R[inst->rt]);
+	op_bgt:  BRANCH(R[inst->rs] > R[inst->rt]);
+	op_ble:  BRANCH(R[inst->rs] <= R[inst->rt]);
+	op_bge:  BRANCH(R[inst->rs] >= R[inst->rt]);
+	op_jal:
+
+		if (check_illegal_write(inst->rd)) NEXT(PC + 1, 0);
+		R[inst->rd] = (int32_t)PC + 1;
+		NEXT(R[inst->rm], 1);
+
+	op_lw:   exec_lw(inst, state);   NEXT(PC + 1, 0);
+	op_sw:   exec_sw(inst, state);   NEXT(PC + 1, 0);
+	op_reti: LEAVE_QUIET(); exec_reti(inst, state); goto cycle_end;
+	op_in:   LEAVE_QUIET(); exec_in(inst, state);   goto cycle_end;
+	op_out:  LEAVE_QUIET(); exec_out(inst, state);  goto cycle_end;
+	op_halt: LEAVE_QUIET(); exec_halt(inst, state); goto cycle_end;
+	op_invalid: LEAVE_QUIET(); exec_invalid(inst, state); goto cycle_end;
+
+	quiet_end:
+
+		account_quiet_cycles(sim, start);
+		state->PC = PC;
+		inst = begin_cycle(sim);			// an event is due, or the run hit NO_EVENT_CYCLES.
+		PC = state->PC;
+		goto *inst->handler;
+
+	cycle_end:
+
+		if (end_cycle(sim)) {
+			return threaded_handlers;
+		}
+
+		PC = state->PC;
+		budget = start = quiet_enabled ? quiet_cycles(sim) : 0;
+
+		if (budget != 0) {
+			inst = &imem[PC];
+			R[1] = inst->imm1;
+			R[2] = inst->imm2;
+			goto *inst->handler;
+		}
+
+		inst = begin_cycle(sim);
+		PC = state->PC;						// begin_cycle may have entered the interrupt handler.
+		goto *inst->handler;
+
+	#undef BRANCH
+	#undef LEAVE_QUIET
+	#undef NEXT
+
+#else
+
+	if (sim == NULL) {
+		return threaded_handlers;
+	}
+
+	machine_state_t* const state = &sim->state;
+	int32_t* const R = state->R;
+	const decoded_instruction_t* const imem = sim->decoded_imem;
+	const int quiet_enabled = !sim->trace_enabled && !LOG_DEBUG_ENABLED;
+	const decoded_instruction_t* inst;
+
+	do {
+
+		int64_t budget = quiet_enabled ? quiet_cycles(sim) : 0;
+		int64_t executed = 0;
+
+		while (executed < budget) {            // quiet run, stopped before the first instruction that needs the full cycle.
+
+			inst = &imem[state->PC];
+
+			if (inst->opcode >= QUIET_OPCODES) {
+				break;
+			}
+
+			R[1] = inst->imm1;
+			R[2] = inst->imm2;
+			inst->handler(inst, state);
+
+			if (state->PC_set_flag) {
+				state->PC_set_flag = 0;
+			}
+			else {
+				state->PC = (state->PC + 1) & PC_MASK;
+			}
+
+			executed++;
+		}
+
+		if (executed != 0) {
+			account_quiet_cycles(sim, executed);
+		}
+
+		inst = begin_cycle(sim);
+		inst->handler(inst, state);
+
+	} while (!end_cycle(sim));
+
+	return threaded_handlers;
+
+#endif
+}
+
+/*
+  description:
+	decodes the whole instruction memory once, at load time. returns malloc`d array indexed by PC.
+	for the threaded engine each instruction is also bound to its handler.
+
+*/
+decoded_instruction_t* predecode_imem(char* imem, engine_t engine) {
+
+	decoded_instruction_t* decoded = calloc_and_check(MEM_SIZE, sizeof(decoded_instruction_t));
+	const threaded_handler_t* handlers = NULL;
+	int i;
+
+	if (engine == ENGINE_THREADED) {
+		handlers = run_threaded(NULL);
+	}
+
+	for (i = 0; i < MEM_SIZE; i++) {
+
+		decode_instruction(imem + i * IMEM_LINE_SIZE, &decoded[i]);
+
+		if (handlers != NULL) {
+			decoded[i].handler = handlers[decoded[i].opcode < NUM_OF_OPCODES ? decoded[i].opcode : NUM_OF_OPCODES];
+		}
+
+	}
+
+	return decoded;
+}
@@ -0,0 +1,206 @@
+#ifndef __SIMULATOR_H__
+#define __SIMULATOR_H__
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "writer.h"
+#include "scheduler.h"
+#include "disk.h"
+
+#define REG_INSTRUCTION_SIZE 1
+#define IMM_INSTRUCTION_SIZE 3
+
+#define TRACE_LINE_SIZE 160
+#define MONITOR_LINE_SIZE 2
+#define IMEM_LINE_SIZE 12
+#define DMEM_LINE_SIZE 8
+#define DISK_LINE_SIZE 8
+
+#define NUM_OF_REGISTERS 16
+#define NUM_OF_IO_REGISTERS 33
+
+#define MEM_SIZE 4096
+#define SECTOR_SIZE 128
+#define MONITOR_BUFF_SIZE 256
+#define MONITOR_PIXELS (MONITOR_BUFF_SIZE * MONITOR_BUFF_SIZE)
+
+#define PC_SIZE 12 
+#define PC_MASK 0xFFF
+#define WORD 32
+
+/*
+  description:
+	IO register indices, named as in hwregtrace. the registers from INSTRUCTIONS on are read only performance
+	counters, counted with --stats and 0 without, see stats.h.
+
+*/
+enum io_register_index {
+	IRQ0ENABLE, IRQ1ENABLE, IRQ2ENABLE, IRQ0STATUS, IRQ1STATUS, IRQ2STATUS, IRQHANDLER, IRQRETURN,
+	CLKS, LEDS, DISPLAY7SEG, TIMERENABLE, TIMERCURRENT, TIMERMAX, DISKCMD, DISKSECTOR, DISKBUFFER, DISKSTATUS,
+	RES1, RES2, MONITORADDR, MONITORDATA, MONITORCMD,
+	INSTRUCTIONS, BRANCHESTAKEN, BRANCHESNOTTAKEN, LOADS, STORES, IOREADS, IOWRITES, INTERRUPTS, IRQCYCLES, DISKCOMMANDS
+};
+
+#define NUM_OF_COUNTERS (NUM_OF_IO_REGISTERS - INSTRUCTIONS)
+#define IO_REGISTER_NAME_SIZE 21
+
+extern const char io_register_names[NUM_OF_IO_REGISTERS][IO_REGISTER_NAME_SIZE];
+
+#define COREID RES1						// reads as the core's number, 0 on a single core. writes are ignored, see multicore.h.
+
+#define NUM_OF_OPCODES 22
+#define QUIET_OPCODES 18				// add through sw, the opcodes a quiet cycle can run without begin_cycle/end_cycle.
+
+#if (defined(__GNUC__) || defined(__clang__)) && !defined(SIMP_NO_COMPUTED_GOTO)
+#define SIMP_COMPUTED_GOTO 1		// labels as values, used by the threaded engine.
+#endif
+
+/*
+  description:
+	architectural state of the machine, held as native integers.
+	text representations are only produced when the trace and output files are written.
+
+*/
+typedef struct {
+	int32_t R[NUM_OF_REGISTERS];
+	int32_t IO[NUM_OF_IO_REGISTERS];
+	uint32_t PC;
+	uint32_t* dmem;
+
+	int PC_set_flag;
+	int halt_flag;
+	int irq_subroutine_flag;
+
+	int hw_info[3];     // hwregtrace info for this cycle : hw_info[0] - register index, hw_info[1] - 1 for READ / 2 for WRITE / 0 for none, hw_info[2] - value
+} machine_state_t;
+
+struct decoded_instruction;
+
+#ifdef SIMP_COMPUTED_GOTO
+typedef void* threaded_handler_t;				// address of the opcode label inside the threaded engine.
+#else
+typedef void (*threaded_handler_t)(const struct decoded_instruction* inst, machine_state_t* state);
+#endif
+
+/*
+  description:
+	instruction fields, decoded once when imem is loaded.
+	handler is bound to the opcode at predecode time when the threaded engine is selected.
+
+*/
+typedef struct decoded_instruction {
+	uint8_t opcode;
+	uint8_t rd;
+	uint8_t rs;
+	uint8_t rt;
+	uint8_t rm;
+	int32_t imm1;
+	int32_t imm2;
+	threaded_handler_t handler;
+} decoded_instruction_t;
+
+typedef enum {
+	ENGINE_SWITCH,
+	ENGINE_THREADED,
+	ENGINE_JIT,
+	ENGINE_AOT
+} engine_t;
+
+struct output;
+struct multicore;
+struct profile;
+struct stats;
+struct jit;
+
+#define IDLE_CANDIDATES 8				// PCs remembered by the idle loop detector, power of 2.
+
+/*
+  description:
+	registers seen the last time a PC was reached at the end of a cycle, by the idle loop detector.
+
+*/
+typedef struct {
+	int valid;
+	uint32_t PC;
+	int32_t R[NUM_OF_REGISTERS];
+} idle_candidate_t;
+
+/*
+  description:
+	everything the main loop needs besides the architectural state: memories, peripherals and output bookkeeping.
+
+*/
+typedef struct {
+	machine_state_t state;
+
+	char* imem;								// imemin text, the trace prints instructions as they appear in the file.
+	decoded_instruction_t* decoded_imem;
+	disk_t* disk;							// disk and monitor are shared by every core of a multi-core machine.
+	char* monitor;
+	char* monitor_hex;
+
+	int trace_enabled;
+	writer_t* trace;						// trace.txt, streamed as it is built.
+	int trace_binary;
+	int32_t trace_previous[NUM_OF_REGISTERS];	// registers in the last binary trace record.
+
+	int* irq2_up_clocks;
+	int num_irq2_up_clocks;
+	int irq2_up_clocks_index;
+
+	int64_t clock;							// cycles run so far, 64 bit so that long runs don't wrap it.
+	int64_t run_limit;						// end_cycle stops the engine once clock reaches it, NEVER when unbounded.
+	int disk_read_end;
+
+	scheduler_t events;						// timer expiry, irq2 edge and disk completion.
+	int timer_dirty;						// a timer register or irq0status changed, reschedule at the end of the cycle.
+
+	int32_t leds;							// last values written to leds.txt and display7seg.txt
+	int32_t display7seg;
+
+	event_log_t hwregtrace_log;
+	event_log_t leds_log;
+	event_log_t display7seg_log;
+
+	struct output* output;					// async output pipeline, NULL when the logs are written in line.
+
+	char* checkpoint_fname;					// --checkpoint, NULL when checkpoints are off.
+	int64_t checkpoint_every;				// cycles between periodic checkpoints, 0 for requested ones only.
+	int64_t next_checkpoint;
+
+	int fast_forward;						// skip idle loops up to the next peripheral event.
+	idle_candidate_t idle_candidates[IDLE_CANDIDATES];
+
+	int core_id;
+	struct multicore* multicore;			// the machine's cores, NULL on a single core machine.
+	struct profile* profile;				// --profile counts, NULL when the machine isn't profiled.
+	struct stats* stats;					// --stats counters, NULL when nothing is counted.
+	struct jit* jit;						// translated code cache, created by the first run_jit and kept until the machine is freed.
+} simulator_t;
+
+#define NO_EVENT_CYCLES ((int64_t)0x7FFFFFFF)	// quiet cycle count when no peripheral event is scheduled at all, or none for that long.
+
+void* calloc_and_check(size_t count, size_t elem_size);
+void write_memory_image(char* p_fname, int line_size, uint32_t* image, int words);
+decoded_instruction_t* predecode_imem(char* imem, engine_t engine);
+int program_length(const char* imem);
+char* build_trace(writer_t* trace, uint32_t PC, const char* instruction, const int32_t R[NUM_OF_REGISTERS], int64_t clock);
+char* write_trace(simulator_t* sim, uint32_t PC, int64_t clock);
+char* write_trace_row(simulator_t* sim, uint32_t PC, const int32_t R[NUM_OF_REGISTERS], int64_t clock);
+void write_hwregtrace(event_log_t* log, int* hw_info, int64_t clock);
+void log_hwregtrace(simulator_t* sim, int* hw_info, int64_t clock);
+void write_output(event_log_t* log, int64_t clock, int led_data);
+
+void execute_instruction(const decoded_instruction_t *inst, machine_state_t *state);
+const decoded_instruction_t* begin_cycle(simulator_t* sim);
+int end_cycle(simulator_t* sim);
+
+int64_t quiet_cycles(const simulator_t* sim);
+void account_quiet_cycles(simulator_t* sim, int64_t cycles);
+
+void init_events(simulator_t* sim);
+void run_switch(simulator_t* sim);
+const threaded_handler_t* run_threaded(simulator_t* sim);
+
+#endif
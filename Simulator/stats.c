@@ -0,0 +1,158 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "stats.h"
+
+static const char opcode_names[NUM_OF_OPCODES + 1][8] = { "add", "sub", "mac", "and", "or", "xor", "sll", "sra", "srl",
+			  "beq", "bne", "blt", "bgt", "ble", "bge", "jal", "lw", "sw", "reti", "in", "out", "halt", "invalid" };
+
+/*
+  description:
+	starts the counters from the counter registers, 0 unless the machine was restored from a checkpoint.
+
+*/
+stats_t* stats_open(machine_state_t* state) {
+
+	stats_t* stats = calloc_and_check(1, sizeof(stats_t));
+
+	for (int counter = 0; counter < NUM_OF_COUNTERS; counter++) {
+		stats->counters[counter] = (uint32_t)state->IO[INSTRUCTIONS + counter];
+	}
+
+	return stats;
+}
+
+/*
+  description:
+	counts the interrupt begin_cycle just took, against every source that was raised and enabled.
+
+*/
+void count_interrupt(stats_t* stats, machine_state_t* state) {
+
+	int32_t* IO_registers = state->IO;
+
+	for (int source = 0; source < 3; source++) {
+		if (IO_registers[IRQ0ENABLE + source] & IO_registers[IRQ0STATUS + source]) {
+			stats->interrupts[source]++;
+		}
+	}
+
+	count_event(stats, state, INTERRUPTS, 1);
+}
+
+/*
+  description:
+	counts a cycle that ran inst. in_handler when the instruction is the interrupt handler's, branched when it set
+	PC. cycles is more than 1 when the cycle ended a run of skipped ones.
+
+*/
+void count_instruction(stats_t* stats, machine_state_t* state, const decoded_instruction_t* inst, int in_handler, int branched, uint32_t cycles) {
+
+	stats->opcodes[inst->opcode < NUM_OF_OPCODES ? inst->opcode : NUM_OF_OPCODES]++;
+	count_event(stats, state, INSTRUCTIONS, 1);
+
+	if (inst->opcode >= 9 && inst->opcode <= 14) {     // branches
+		count_event(stats, state, branched ? BRANCHESTAKEN : BRANCHESNOTTAKEN, 1);
+	}
+	else if (inst->opcode == 16) {
+		count_event(stats, state, LOADS, 1);
+	}
+	else if (inst->opcode == 17) {
+		count_event(stats, state, STORES, 1);
+	}
+
+	if (in_handler) {
+		count_event(stats, state, IRQCYCLES, cycles);
+	}
+}
+
+/*
+  description:
+	the switch interpreter's loop, counting each cycle.
+
+*/
+void run_counted(simulator_t* sim) {
+
+	stats_t* stats = sim->stats;
+	machine_state_t* state = &sim->state;
+	const decoded_instruction_t* inst;
+	int done;
+
+	do {
+
+		int64_t clock = sim->clock;
+		int in_handler = state->irq_subroutine_flag;
+		int branched;
+
+		inst = begin_cycle(sim);
+
+		if (!in_handler && state->irq_subroutine_flag) {
+			count_interrupt(stats, state);
+		}
+
+		in_handler = state->irq_subroutine_flag;
+
+		execute_instruction(inst, state);
+		branched = state->PC_set_flag;
+
+		done = end_cycle(sim);
+		count_instruction(stats, state, inst, in_handler, branched, (uint32_t)(sim->clock - clock));
+
+	} while (!done);
+}
+
+static void write_counts(FILE* fptr, const char* name, const uint64_t* counts, const char (*names)[IO_REGISTER_NAME_SIZE], int size) {
+
+	fprintf(fptr, "  \"%s\": {", name);
+
+	for (int i = 0; i < size; i++) {
+		fprintf(fptr, "%s\"%s\": %llu", i > 0 ? ", " : "", names[i], (unsigned long long)counts[i]);
+	}
+
+	fprintf(fptr, "},\n");
+}
+
+/*
+  description:
+	writes the counters as a JSON object, every count present even when 0.
+
+*/
+void write_stats(const stats_t* stats, const simulator_t* sim, char* fname) {
+
+	FILE* fptr;
+	int i;
+
+	fopen_s(&fptr, fname, "w");
+
+	if (fptr == NULL) {
+		printf("IO error encountered\nTerminating program...");
+		exit(-1);
+	}
+
+	fprintf(fptr, "{\n  \"cycles\": %lld,\n  \"halted\": %s,\n", (long long)sim->clock, sim->state.halt_flag ? "true" : "false");
+	fprintf(fptr, "  \"instructions\": %llu,\n", (unsigned long long)stats->counters[0]);
+
+	fprintf(fptr, "  \"opcodes\": {");
+	for (i = 0; i <= NUM_OF_OPCODES; i++) {
+		fprintf(fptr, "%s\"%s\": %llu", i > 0 ? ", " : "", opcode_names[i], (unsigned long long)stats->opcodes[i]);
+	}
+	fprintf(fptr, "},\n");
+
+	fprintf(fptr, "  \"branches\": {\"taken\": %llu, \"not_taken\": %llu},\n",
+			(unsigned long long)stats->counters[BRANCHESTAKEN - INSTRUCTIONS], (unsigned long long)stats->counters[BRANCHESNOTTAKEN - INSTRUCTIONS]);
+	fprintf(fptr, "  \"loads\": %llu,\n  \"stores\": %llu,\n",
+			(unsigned long long)stats->counters[LOADS - INSTRUCTIONS], (unsigned long long)stats->counters[STORES - INSTRUCTIONS]);
+
+	write_counts(fptr, "io_reads", stats->io_reads, io_register_names, NUM_OF_IO_REGISTERS);
+	write_counts(fptr, "io_writes", stats->io_writes, io_register_names, NUM_OF_IO_REGISTERS);
+
+	fprintf(fptr, "  \"interrupts\": {\"irq0\": %llu, \"irq1\": %llu, \"irq2\": %llu, \"total\": %llu},\n",
+			(unsigned long long)stats->interrupts[0], (unsigned long long)stats->interrupts[1], (unsigned long long)stats->interrupts[2],
+			(unsigned long long)stats->counters[INTERRUPTS - INSTRUCTIONS]);
+	fprintf(fptr, "  \"interrupt_handler_cycles\": %llu,\n", (unsigned long long)stats->counters[IRQCYCLES - INSTRUCTIONS]);
+	fprintf(fptr, "  \"disk_commands\": {\"read\": %llu, \"write\": %llu}\n}\n",
+			(unsigned long long)stats->disk_reads, (unsigned long long)stats->disk_writes);
+
+	fclose(fptr);
+}
@@ -0,0 +1,68 @@
+#ifndef __STATS_H__
+#define __STATS_H__
+
+#include "simulator.h"
+
+/*
+  description:
+	performance counters, selected with --stats=FILE: instructions per opcode, taken and not taken branches, loads
+	and stores, reads and writes of each IO register, interrupts taken per source, cycles run inside interrupt
+	handlers and disk commands. simp_dump writes them to FILE as a JSON object, next to cycles.txt.
+
+	the totals are also the read only IO registers from INSTRUCTIONS on, so a program can measure itself: an in
+	returns the count as it stood at the start of the cycle, its low 32 bits. writes are ignored, and without
+	--stats the registers read 0. a checkpoint keeps the registers, the breakdowns restart from the restore.
+
+	a counted machine runs on run_counted, a counting copy of the switch interpreter's loop, or on run_profiled with
+	--profile, whatever the engine. --fast-forward is ignored, skipped loop passes would go uncounted. IO accesses
+	and disk commands are counted where they are serviced, only when --stats is on.
+
+*/
+
+typedef struct stats {
+	uint64_t counters[NUM_OF_COUNTERS];			// the counter registers in full, counters[0] is INSTRUCTIONS.
+	uint64_t opcodes[NUM_OF_OPCODES + 1];		// the last one counts invalid opcodes.
+	uint64_t io_reads[NUM_OF_IO_REGISTERS];
+	uint64_t io_writes[NUM_OF_IO_REGISTERS];
+	uint64_t interrupts[3];						// irq0, irq1 and irq2.
+	uint64_t disk_reads;
+	uint64_t disk_writes;
+} stats_t;
+
+static inline void count_event(stats_t* stats, machine_state_t* state, int counter, uint64_t amount) {
+
+	stats->counters[counter - INSTRUCTIONS] += amount;
+	state->IO[counter] = (int32_t)stats->counters[counter - INSTRUCTIONS];
+}
+
+static inline void count_io_access(stats_t* stats, machine_state_t* state, int index, int access) {
+
+	if (access == 1) {
+		stats->io_reads[index]++;
+		count_event(stats, state, IOREADS, 1);
+	}
+	else {
+		stats->io_writes[index]++;
+		count_event(stats, state, IOWRITES, 1);
+	}
+}
+
+static inline void count_disk_command(stats_t* stats, machine_state_t* state, int read) {
+
+	if (read) {
+		stats->disk_reads++;
+	}
+	else {
+		stats->disk_writes++;
+	}
+
+	count_event(stats, state, DISKCOMMANDS, 1);
+}
+
+stats_t* stats_open(machine_state_t* state);
+void count_interrupt(stats_t* stats, machine_state_t* state);
+void count_instruction(stats_t* stats, machine_state_t* state, const decoded_instruction_t* inst, int in_handler, int branched, uint32_t cycles);
+void run_counted(simulator_t* sim);
+void write_stats(const stats_t* stats, const simulator_t* sim, char* fname);
+
+#endif
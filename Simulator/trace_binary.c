@@ -0,0 +1,168 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "trace_binary.h"
+
+static void put_u16(char* p, uint32_t value) {
+
+	p[0] = (char)(value & 0xFF);
+	p[1] = (char)((value >> 8) & 0xFF);
+}
+
+static void put_u32(char* p, uint32_t value) {
+
+	put_u16(p, value & 0xFFFF);
+	put_u16(p + 2, value >> 16);
+}
+
+static uint32_t get_u16(const unsigned char* p) {
+
+	return (uint32_t)p[0] | ((uint32_t)p[1] << 8);
+}
+
+static uint32_t get_u32(const unsigned char* p) {
+
+	return get_u16(p) | (get_u16(p + 2) << 16);
+}
+
+void write_binary_trace_header(writer_t* trace, const char* imem) {
+
+	int length = program_length(imem);
+
+	writer_write(trace, TRACE_BINARY_MAGIC, TRACE_BINARY_MAGIC_SIZE);
+	put_u16(writer_reserve(trace, 2), length);
+	writer_write(trace, imem, length * IMEM_LINE_SIZE);
+}
+
+/*
+  description:
+	appends the record for the current clock, and updates previous to the registers just recorded.
+
+*/
+void build_binary_trace(writer_t* trace, uint32_t PC, const int32_t R[NUM_OF_REGISTERS], int32_t previous[NUM_OF_REGISTERS]) {
+
+	char record[TRACE_BINARY_MAX_RECORD];
+	int size = 4;
+	uint32_t mask = 0;
+	int i;
+
+	for (i = 0; i < NUM_OF_REGISTERS; i++) {
+
+		if (R[i] != previous[i]) {
+
+			mask |= 1u << i;
+			put_u32(record + size, (uint32_t)R[i]);
+			size += 4;
+			previous[i] = R[i];
+		}
+	}
+
+	put_u16(record, PC);
+	put_u16(record + 2, mask);
+	writer_write(trace, record, size);
+}
+
+/*
+  description:
+	fills buffer so it holds at least 'needed' unread bytes, or everything left in the file.
+	returns the number of unread bytes.
+
+*/
+static size_t refill(FILE* fptr, unsigned char* buffer, size_t buffer_size, size_t* position, size_t* end, size_t needed) {
+
+	if (*end - *position < needed) {
+
+		memmove(buffer, buffer + *position, *end - *position);
+		*end -= *position;
+		*position = 0;
+		*end += fread(buffer + *end, sizeof(char), buffer_size - *end, fptr);
+	}
+
+	return *end - *position;
+}
+
+/*
+  description:
+	renders a binary trace to the text format build_trace produces.
+
+	parameters:
+	in binary_fname - trace written with --binary-trace.
+	in text_fname - trace.txt to write.
+
+*/
+void decode_binary_trace(char* binary_fname, char* text_fname) {
+
+	FILE* fptr;
+	size_t buffer_size = WRITER_BUFFER_SIZE;
+	unsigned char* buffer = calloc_and_check(buffer_size, sizeof(char));
+	size_t position = 0;
+	size_t end = 0;
+	size_t available;
+	char* imem = calloc_and_check(MEM_SIZE * IMEM_LINE_SIZE, sizeof(char));
+	int32_t R[NUM_OF_REGISTERS] = { 0 };
+	int length;
+	int64_t clock = 0;
+	int i;
+
+	fopen_s(&fptr, binary_fname, "rb");
+
+	if (fptr == NULL) {
+		printf("IO error encountered\nTerminating program...");
+		exit(-1);
+	}
+
+	if (refill(fptr, buffer, buffer_size, &position, &end, TRACE_BINARY_MAGIC_SIZE + 2) < TRACE_BINARY_MAGIC_SIZE + 2 ||
+		memcmp(buffer, TRACE_BINARY_MAGIC, TRACE_BINARY_MAGIC_SIZE) != 0) {
+		printf("%s is not a binary trace\nTerminating program...", binary_fname);
+		exit(-1);
+	}
+
+	length = get_u16(buffer + TRACE_BINARY_MAGIC_SIZE);
+	position += TRACE_BINARY_MAGIC_SIZE + 2;
+
+	if (length > MEM_SIZE || refill(fptr, buffer, buffer_size, &position, &end, length * IMEM_LINE_SIZE) < (size_t)length * IMEM_LINE_SIZE) {
+		printf("%s is truncated\nTerminating program...", binary_fname);
+		exit(-1);
+	}
+
+	memset(imem, '0', MEM_SIZE * IMEM_LINE_SIZE);		// lines past the program read as zeros, as in readfile.
+	memcpy(imem, buffer + position, length * IMEM_LINE_SIZE);
+	position += length * IMEM_LINE_SIZE;
+
+	writer_t* trace = writer_open(text_fname, WRITER_BUFFER_SIZE, 0);
+
+	while ((available = refill(fptr, buffer, buffer_size, &position, &end, TRACE_BINARY_MAX_RECORD)) > 0) {
+
+		uint32_t PC = get_u16(buffer + position) & PC_MASK;
+		uint32_t mask = available >= 4 ? get_u16(buffer + position + 2) : 0;
+		size_t size = 4;
+
+		for (i = 0; i < NUM_OF_REGISTERS; i++) {
+			if (mask & (1u << i)) size += 4;
+		}
+
+		if (available < size) {
+			printf("%s is truncated\nTerminating program...", binary_fname);
+			exit(-1);
+		}
+
+		position += 4;
+
+		for (i = 0; i < NUM_OF_REGISTERS; i++) {
+
+			if (mask & (1u << i)) {
+				R[i] = (int32_t)get_u32(buffer + position);
+				position += 4;
+			}
+		}
+
+		build_trace(trace, PC, imem + PC * IMEM_LINE_SIZE, R, clock);
+		clock++;
+	}
+
+	writer_close(trace);
+	fclose(fptr);
+	free(imem);
+	free(buffer);
+}
@@ -0,0 +1,26 @@
+#ifndef __TRACE_BINARY_H__
+#define __TRACE_BINARY_H__
+
+#include "simulator.h"
+
+/*
+  description:
+	compact binary trace, selected with --binary-trace, and its renderer back to the trace.txt text format.
+
+	file layout, all integers little endian:
+	header  - "SIMPTRC1", u16 program length, program length * 12 bytes of imemin text (so instructions render exactly
+	          as they appear in imemin).
+	records - one per clock: u16 PC, u16 mask of the registers that changed since the previous record (all zero before
+	          the first), then the new value of each changed register as an i32, lowest register first.
+
+*/
+
+#define TRACE_BINARY_MAGIC "SIMPTRC1"
+#define TRACE_BINARY_MAGIC_SIZE 8
+#define TRACE_BINARY_MAX_RECORD (4 + 4 * NUM_OF_REGISTERS)
+
+void write_binary_trace_header(writer_t* trace, const char* imem);
+void build_binary_trace(writer_t* trace, uint32_t PC, const int32_t R[NUM_OF_REGISTERS], int32_t previous[NUM_OF_REGISTERS]);
+void decode_binary_trace(char* binary_fname, char* text_fname);
+
+#endif
@@ -0,0 +1,233 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "writer.h"
+#include "simulator.h"
+
+#ifdef _WIN32
+#include <io.h>
+#define ftell64 _ftelli64
+#define fseek64 _fseeki64
+#define truncate_file(fptr, size) _chsize_s(_fileno(fptr), size)
+#else
+#include <unistd.h>
+#define ftell64 ftello
+#define fseek64 fseeko
+#define truncate_file(fptr, size) ftruncate(fileno(fptr), size)
+#endif
+
+/*
+  description:
+	writes size bytes of data as the whole of p_fname, in text or binary mode. used for the outputs that are formatted
+	in memory at the end of the run: the stream is unbuffered so the data goes to the file in one write, not copied
+	through the stdio buffer a block at a time.
+
+*/
+void write_file(char* p_fname, const char* data, size_t size, int binary_flag) {
+
+	FILE* fptr;
+
+	if (binary_flag)
+		fopen_s(&fptr, p_fname, "wb");
+	else
+		fopen_s(&fptr, p_fname, "w");
+
+	if (fptr == NULL) {
+		printf("IO error encountered\nTerminating program...");
+		exit(-1);
+	}
+
+	setvbuf(fptr, NULL, _IONBF, 0);
+
+	if (size != 0 && fwrite(data, sizeof(char), size, fptr) != size) {
+		printf("IO error encountered\nTerminating program...");
+		exit(-1);
+	}
+
+	fclose(fptr);
+}
+
+/*
+  description:
+	opens p_fname for writing, text or binary as in write_file.
+
+*/
+writer_t* writer_open(char* p_fname, size_t buffer_size, int binary_flag) {
+
+	writer_t* writer = calloc_and_check(1, sizeof(writer_t));
+
+	if (binary_flag)
+		fopen_s(&writer->fptr, p_fname, "wb");
+	else
+		fopen_s(&writer->fptr, p_fname, "w");
+
+	if (writer->fptr == NULL) {
+		printf("IO error encountered\nTerminating program...");
+		exit(-1);
+	}
+
+	writer->buffer = calloc_and_check(buffer_size, sizeof(char));
+	writer->size = buffer_size;
+	writer->used = 0;
+
+	return writer;
+}
+
+/*
+  description:
+	reopens p_fname to carry on writing at offset, dropping anything after it. used to resume from a checkpoint.
+	the file must be at least offset bytes long.
+
+*/
+writer_t* writer_resume(char* p_fname, size_t buffer_size, int binary_flag, int64_t offset) {
+
+	writer_t* writer = calloc_and_check(1, sizeof(writer_t));
+
+	if (binary_flag)
+		fopen_s(&writer->fptr, p_fname, "r+b");
+	else
+		fopen_s(&writer->fptr, p_fname, "r+");
+
+	if (writer->fptr == NULL || fseek64(writer->fptr, 0, SEEK_END) != 0 || ftell64(writer->fptr) < offset ||
+		truncate_file(writer->fptr, offset) != 0 || fseek64(writer->fptr, offset, SEEK_SET) != 0) {
+		printf("IO error encountered, %s doesn't match the checkpoint\nTerminating program...", p_fname);
+		exit(-1);
+	}
+
+	writer->buffer = calloc_and_check(buffer_size, sizeof(char));
+	writer->size = buffer_size;
+	writer->used = 0;
+
+	return writer;
+}
+
+/*
+  description:
+	size of the file once everything written so far is in it.
+
+*/
+int64_t writer_offset(writer_t* writer) {
+
+	writer_flush(writer);
+	fflush(writer->fptr);
+
+	return ftell64(writer->fptr);
+}
+
+void writer_flush(writer_t* writer) {
+
+	if (writer->used != 0 && fwrite(writer->buffer, sizeof(char), writer->used, writer->fptr) != writer->used) {
+		printf("IO error encountered\nTerminating program...");
+		exit(-1);
+	}
+
+	writer->used = 0;
+}
+
+/*
+  description:
+	returns room for length bytes in the buffer, flushing first if needed. the caller fills all of it.
+
+*/
+char* writer_reserve(writer_t* writer, size_t length) {
+
+	char* space;
+
+	if (writer->used + length > writer->size) {
+		writer_flush(writer);
+	}
+
+	if (length > writer->size) {                     // records never come close to the buffer size.
+		printf("Memory assignment error encountered\nTerminating program...");
+		exit(-1);
+	}
+
+	space = writer->buffer + writer->used;
+	writer->used += length;
+
+	return space;
+}
+
+void writer_write(writer_t* writer, const char* data, size_t length) {
+
+	if (length > writer->size) {
+		writer_flush(writer);
+
+		if (fwrite(data, sizeof(char), length, writer->fptr) != length) {
+			printf("IO error encountered\nTerminating program...");
+			exit(-1);
+		}
+
+		return;
+	}
+
+	memcpy(writer_reserve(writer, length), data, length);
+}
+
+void writer_close(writer_t* writer) {
+
+	writer_flush(writer);
+
+	if (fclose(writer->fptr) != 0) {            // stdio's own buffer is written out here.
+		printf("IO error encountered\nTerminating program...");
+		exit(-1);
+	}
+
+	free(writer->buffer);
+	free(writer);
+}
+
+void event_log_init(event_log_t* log, char* fname) {
+
+	log->fname = fname;
+	log->writer = NULL;
+}
+
+/*
+  description:
+	appends a record. a log with no file name, as a library caller can leave one, drops its records.
+
+*/
+void event_log_write(event_log_t* log, const char* record, size_t length) {
+
+	if (log->fname == NULL) {
+		return;
+	}
+
+	if (log->writer == NULL) {
+		log->writer = writer_open(log->fname, EVENT_LOG_BUFFER_SIZE, 0);
+	}
+	else {
+		writer_write(log->writer, "\n", 1);
+	}
+
+	writer_write(log->writer, record, length);
+}
+
+/*
+  description:
+	as event_log_init, carrying on from a checkpoint. offset is the file size then, or -1 if it wasn't created yet.
+
+*/
+void event_log_resume(event_log_t* log, char* fname, int64_t offset) {
+
+	event_log_init(log, fname);
+
+	if (offset >= 0 && fname != NULL) {
+		log->writer = writer_resume(fname, EVENT_LOG_BUFFER_SIZE, 0, offset);
+	}
+}
+
+int64_t event_log_offset(event_log_t* log) {
+
+	return log->writer != NULL ? writer_offset(log->writer) : -1;
+}
+
+void event_log_close(event_log_t* log) {
+
+	if (log->writer != NULL) {
+		writer_close(log->writer);
+		log->writer = NULL;
+	}
+}
@@ -0,0 +1,51 @@
+#ifndef __WRITER_H__
+#define __WRITER_H__
+
+#include <stdio.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define WRITER_BUFFER_SIZE (1 << 20)
+#define EVENT_LOG_BUFFER_SIZE (64 * 1024)
+
+/*
+  description:
+	output file with a fixed size buffer. records are formatted straight into the buffer and written out in large
+	blocks, so memory use doesn't depend on how much is written.
+
+*/
+typedef struct {
+	FILE* fptr;
+	char* buffer;
+	size_t size;
+	size_t used;
+} writer_t;
+
+/*
+  description:
+	event log (hwregtrace, leds, display7seg). the file is created on the first record and kept open, records are
+	separated by newlines with no newline after the last, as the per-event writers produced.
+
+*/
+typedef struct {
+	char* fname;
+	writer_t* writer;				// NULL until the first record.
+} event_log_t;
+
+void write_file(char* p_fname, const char* data, size_t size, int binary_flag);
+
+writer_t* writer_open(char* p_fname, size_t buffer_size, int binary_flag);
+writer_t* writer_resume(char* p_fname, size_t buffer_size, int binary_flag, int64_t offset);
+int64_t writer_offset(writer_t* writer);
+char* writer_reserve(writer_t* writer, size_t length);
+void writer_write(writer_t* writer, const char* data, size_t length);
+void writer_flush(writer_t* writer);
+void writer_close(writer_t* writer);
+
+void event_log_init(event_log_t* log, char* fname);
+void event_log_resume(event_log_t* log, char* fname, int64_t offset);
+int64_t event_log_offset(event_log_t* log);
+void event_log_write(event_log_t* log, const char* record, size_t length);
+void event_log_close(event_log_t* log);
+
+#endif